@@ -23,6 +23,13 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -76,6 +83,65 @@ int Gia_FileSize( char * pFileName )
     fclose( pFile );
     return nFileSize;
 }
+char * Gia_FileMap( char * pFileName, size_t * pnFileSize, int * pfMapped )
+{
+    FILE * pFile;
+    char * pContents;
+    size_t nFileSize;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 || fstat( fd, &Stat ) == -1 )
+    {
+        if ( fd != -1 )
+            close( fd );
+        printf( "Gia_FileMap(): The file is unavailable (absent or open).\n" );
+        return NULL;
+    }
+    nFileSize = (size_t)Stat.st_size;
+    // the private mapping is writable because the reader terminates the names in place;
+    // the reader also expects a zero byte after the contents, which the mapping has only
+    // if the file ends before the last page does, so other files take the read path
+    pContents = (nFileSize % (size_t)sysconf(_SC_PAGESIZE)) ? (char *)mmap( NULL, nFileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 ) : (char *)MAP_FAILED;
+    close( fd );
+    if ( pContents != (char *)MAP_FAILED )
+    {
+        madvise( pContents, nFileSize, MADV_SEQUENTIAL );
+        *pnFileSize = nFileSize;
+        *pfMapped = 1;
+        return pContents;
+    }
+#endif
+    // read the file into the buffer
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_FileMap(): The file is unavailable (absent or open).\n" );
+        return NULL;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (size_t)ftell( pFile );
+    rewind( pFile );
+    pContents = ABC_ALLOC( char, nFileSize + 1 );
+    if ( fread( pContents, 1, nFileSize, pFile ) != nFileSize )
+        printf( "Gia_FileMap(): Reading the file has failed.\n" );
+    pContents[nFileSize] = 0;
+    fclose( pFile );
+    *pnFileSize = nFileSize;
+    *pfMapped = 0;
+    return pContents;
+}
+void Gia_FileUnmap( char * pContents, size_t nFileSize, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+    {
+        munmap( pContents, nFileSize );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
 void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
 {
     unsigned char Buffer[5];
@@ -162,6 +228,11 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
     return vBinary;
 }
 
+static inline int Gia_AigerReadNode( Vec_Int_t * vNodes, unsigned uLit )
+{
+    return vNodes ? Abc_LitNotCond( Vec_IntEntry(vNodes, uLit >> 1), (uLit & 1) ) : (int)uLit;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -173,7 +244,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -258,15 +329,17 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     pNew->nConstrs = nConstr;
     pNew->fGiaSimple = fGiaSimple;
 
-    // prepare the array of nodes
-    vNodes = Vec_IntAlloc( 1 + nTotal );
-    Vec_IntPush( vNodes, 0 );
+    // prepare the array of nodes (without hashing, AIGER literals are the literals of the new AIG)
+    vNodes = (!fGiaSimple && fSkipStrash) ? NULL : Vec_IntAlloc( 1 + nTotal );
+    if ( vNodes )
+        Vec_IntPush( vNodes, 0 );
 
     // create the PIs
     for ( i = 0; i < nInputs + nLatches; i++ )
     {
         iObj = Gia_ManAppendCi(pNew);    
-        Vec_IntPush( vNodes, iObj );
+        if ( vNodes )
+            Vec_IntPush( vNodes, iObj );
     }
 
     // remember the beginning of latch/PO literals
@@ -284,29 +357,39 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // create the AND gates
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashAlloc( pNew );
-    for ( i = 0; i < nAnds; i++ )
+    if ( vNodes == NULL && nProcs > 1 ) // decode the literals into the objects concurrently
+        pCur = Gia_AigerReadAndsPar( pNew, pCur, nAnds, nProcs );
+    else if ( vNodes == NULL ) // decode the literals directly into the objects
     {
-        uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
-//        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
-        assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
-        if ( !fGiaSimple && fSkipStrash )
+        for ( i = 0; i < nAnds; i++ )
         {
-            if ( iNode0 == iNode1 )
-                Vec_IntPush( vNodes, Gia_ManAppendBuf(pNew, iNode0) );
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+            if ( uLit0 == uLit1 )
+                Gia_ManAppendBuf( pNew, uLit0 );
             else
-                Vec_IntPush( vNodes, Gia_ManAppendAnd(pNew, iNode0, iNode1) );
+                Gia_ManAppendAnd( pNew, uLit0, uLit1 );
         }
-        else
+    }
+    else
+    {
+        if ( !fGiaSimple )
+            Gia_ManHashAlloc( pNew );
+        for ( i = 0; i < nAnds; i++ )
+        {
+            uLit = ((i + 1 + nInputs + nLatches) << 1);
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+//            assert( uLit1 > uLit0 );
+            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
+            iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+            assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
             Vec_IntPush( vNodes, Gia_ManHashAnd(pNew, iNode0, iNode1) );
+        }
+        if ( !fGiaSimple )
+            Gia_ManHashStop( pNew );
     }
-    if ( !fGiaSimple && !fSkipStrash )
-        Gia_ManHashStop( pNew );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -333,14 +416,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 pCur++;
                 Vec_IntPush( vInits, 0 );
             }
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = atoi( (char *)pCur );   while ( *pCur++ != '\n' );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
 
@@ -351,14 +434,14 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         for ( i = 0; i < nLatches; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         // read the PO driver literals
         for ( i = 0; i < nOutputs; i++ )
         {
             uLit0 = Vec_IntEntry( vLits, i+nLatches );
-            iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), (uLit0 & 1) );
+            iNode0 = Gia_AigerReadNode( vNodes, uLit0 );
             Vec_IntPush( vDrivers, iNode0 );
         }
         Vec_IntFree( vLits );
@@ -875,7 +958,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
 
     // skipping the comments
-    Vec_IntFree( vNodes );
+    Vec_IntFreeP( &vNodes );
 
     // update polarity of the additional outputs
     if ( nBad || nConstr || nJust || nFair )
@@ -1002,6 +1085,10 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( vNamesRegOut ) Vec_PtrFreeFree( vNamesRegOut );
     return pNew;
 }
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
 
 /**Function*************************************************************
 
@@ -1014,24 +1101,20 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nProcs )
 {
-    FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    size_t nFileSize;
+    int fMapped;
 
-    // read the file into the buffer
+    // map the file into memory
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    pContents = Gia_FileMap( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
+        return NULL;
+    pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nProcs );
+    Gia_FileUnmap( pContents, nFileSize, fMapped );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1044,6 +1127,10 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     }
     return pNew;
 }
+Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
 
 
 
@@ -1217,7 +1304,7 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+void Gia_AigerWriteSPar( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment, int nProcs )
 {
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
@@ -1289,32 +1376,41 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
+    // write the nodes concurrently
+    if ( nProcs > 1 && Gia_ManAndNum(p) > 0 )
+    {
+        if ( !Gia_AigerWriteAndsPar( p, pFile, nProcs ) )
+            printf( "Gia_AigerWrite(): Writing the AND gates into the file has failed.\n" );
+    }
+    else
     {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        // write the nodes into the buffer
+        Pos = 0;
+        nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+        pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+        Gia_ManForEachAnd( p, pObj, i )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+            if ( Pos > nBufferSize - 10 )
+            {
+                printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+                fclose( pFile );
+                if ( p != pInit )
+                    Gia_ManStop( p );
+                return;
+            }
         }
-    }
-    assert( Pos < nBufferSize );
+        assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+        // write the buffer
+        fwrite( pBuffer, 1, Pos, pFile );
+        ABC_FREE( pBuffer );
+    }
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1580,6 +1676,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         Gia_ManStop( p );
     }
 }
+void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
+{
+    Gia_AigerWriteSPar( pInit, pFileName, fWriteSymbols, fCompact, fWriteNewLine, fSkipComment, 1 );
+}
 
 /**Function*************************************************************
 
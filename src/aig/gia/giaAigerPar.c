@@ -0,0 +1,362 @@
+/**CFile****************************************************************
+
+  FileName    [giaAigerPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Concurrent encoding and decoding of the AND gates in AIGER.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_AIG_THR_MAX      100     // the max number of threads
+#define GIA_AIG_CHUNKS         4     // the number of chunks per thread
+#define GIA_AIG_CHUNK_MAX  (1<<24)   // the max number of AND gates in one chunk
+
+// the range of AND gates processed by one thread
+typedef struct Gia_AigChunk_t_ Gia_AigChunk_t;
+struct Gia_AigChunk_t_
+{
+    int              iBeg;       // the first object
+    int              iEnd;       // the object following the last one
+    unsigned char *  pBeg;       // the encoding of the first object (reading)
+    size_t           nBytes;     // the size of the encoding (writing)
+    size_t           Offset;     // the file offset of the encoding (writing)
+    int              nBufs;      // the number of buffers (reading)
+    int              Status;     // the result of writing
+};
+
+// information shared by the threads
+typedef struct Gia_AigQueue_t_ Gia_AigQueue_t;
+struct Gia_AigQueue_t_
+{
+    Gia_Man_t *      p;          // the AIG
+    int              fd;         // the output file
+    int              Pass;       // 0 = sizing, 1 = writing, 2 = reading
+    Gia_AigChunk_t * pChunks;    // the chunks
+    int              nChunks;    // the number of chunks
+    int              iNext;      // the next chunk to process
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;      // protects the queue
+#endif
+};
+
+static inline int Gia_AigerUnsignedSize( unsigned x )
+{
+    return x < (1u << 7) ? 1 : x < (1u << 14) ? 2 : x < (1u << 21) ? 3 : x < (1u << 28) ? 4 : 5;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Divides the AND gates into chunks.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_AigChunk_t * Gia_AigerDeriveChunks( int iFirst, int nAnds, int nProcs, int * pnChunks )
+{
+    Gia_AigChunk_t * pChunks;
+    int i, nSize, nChunks;
+    nChunks = Abc_MaxInt( nProcs * GIA_AIG_CHUNKS, nAnds / GIA_AIG_CHUNK_MAX + 1 );
+    nSize   = Abc_MaxInt( 1, (nAnds + nChunks - 1) / nChunks );
+    nChunks = (nAnds + nSize - 1) / nSize;
+    pChunks = ABC_CALLOC( Gia_AigChunk_t, Abc_MaxInt(nChunks, 1) );
+    for ( i = 0; i < nChunks; i++ )
+    {
+        pChunks[i].iBeg = iFirst + i * nSize;
+        pChunks[i].iEnd = iFirst + Abc_MinInt( (i + 1) * nSize, nAnds );
+    }
+    *pnChunks = nChunks;
+    return pChunks;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes one chunk.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerChunkSize( Gia_Man_t * p, Gia_AigChunk_t * pChunk )
+{
+    Gia_Obj_t * pObj;
+    unsigned uLit, uLit0, uLit1;
+    int i;
+    pChunk->nBytes = 0;
+    for ( i = pChunk->iBeg; i < pChunk->iEnd; i++ )
+    {
+        pObj  = Gia_ManObj( p, i );
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        pChunk->nBytes += Gia_AigerUnsignedSize( uLit - uLit1 ) + Gia_AigerUnsignedSize( uLit1 - uLit0 );
+    }
+}
+void Gia_AigerChunkEncode( Gia_Man_t * p, Gia_AigChunk_t * pChunk, unsigned char * pBuffer )
+{
+    Gia_Obj_t * pObj;
+    unsigned uLit, uLit0, uLit1;
+    int i, Pos = 0;
+    for ( i = pChunk->iBeg; i < pChunk->iEnd; i++ )
+    {
+        pObj  = Gia_ManObj( p, i );
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+    }
+    assert( (size_t)Pos == pChunk->nBytes );
+}
+void Gia_AigerChunkDecode( Gia_Man_t * p, Gia_AigChunk_t * pChunk )
+{
+    unsigned char * pCur = pChunk->pBeg;
+    Gia_Obj_t * pObj;
+    unsigned uLit, uLit0, uLit1;
+    int i;
+    pChunk->nBufs = 0;
+    for ( i = pChunk->iBeg; i < pChunk->iEnd; i++ )
+    {
+        pObj  = p->pObjs + i;      // the object is not yet counted in p->nObjs
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        assert( uLit0 <= uLit1 && uLit1 < uLit );
+        // the same as Gia_ManAppendAnd() and Gia_ManAppendBuf()
+        pObj->iDiff0  = (unsigned)(i - Abc_Lit2Var(uLit0));
+        pObj->fCompl0 = (unsigned)Abc_LitIsCompl(uLit0);
+        pObj->iDiff1  = (unsigned)(i - Abc_Lit2Var(uLit1));
+        pObj->fCompl1 = (unsigned)Abc_LitIsCompl(uLit1);
+        pChunk->nBufs += (uLit0 == uLit1);
+    }
+}
+void Gia_AigerChunkProcess( Gia_AigQueue_t * p, Gia_AigChunk_t * pChunk )
+{
+    if ( p->Pass == 0 )
+        Gia_AigerChunkSize( p->p, pChunk );
+    else if ( p->Pass == 1 )
+    {
+        unsigned char * pBuffer = ABC_ALLOC( unsigned char, Abc_MaxInt((int)pChunk->nBytes, 1) );
+        size_t nDone = 0;
+        Gia_AigerChunkEncode( p->p, pChunk, pBuffer );
+        pChunk->Status = 1;
+#ifndef _WIN32
+        while ( nDone < pChunk->nBytes )
+        {
+            ssize_t RetValue = pwrite( p->fd, pBuffer + nDone, pChunk->nBytes - nDone, (off_t)(pChunk->Offset + nDone) );
+            if ( RetValue <= 0 )
+            {
+                pChunk->Status = 0;
+                break;
+            }
+            nDone += (size_t)RetValue;
+        }
+#endif
+        ABC_FREE( pBuffer );
+    }
+    else
+        Gia_AigerChunkDecode( p->p, pChunk );
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Gia_AigerProcessChunks( Gia_AigQueue_t * p, int nProcs )
+{
+    int i;
+    for ( i = 0; i < p->nChunks; i++ )
+        Gia_AigerChunkProcess( p, p->pChunks + i );
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the chunks taken from the queue.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_AigerProcessChunksThread( void * pArg )
+{
+    Gia_AigQueue_t * p = (Gia_AigQueue_t *)pArg;
+    Gia_AigChunk_t * pChunk;
+    int status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        pChunk = p->iNext < p->nChunks ? p->pChunks + p->iNext++ : NULL;
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+        if ( pChunk == NULL )
+            break;
+        Gia_AigerChunkProcess( p, pChunk );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+void Gia_AigerProcessChunks( Gia_AigQueue_t * p, int nProcs )
+{
+    pthread_t WorkerThread[GIA_AIG_THR_MAX];
+    int i, status;
+    nProcs = Abc_MinInt( Abc_MinInt(nProcs, GIA_AIG_THR_MAX), p->nChunks );
+    p->iNext = 0;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Gia_AigerProcessChunksThread, (void *)p );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AND gates of the normalized AIG into the file.]
+
+  Description [The first pass computes the size of the encoding of each
+  chunk of the AND gates. The second pass encodes the chunks and writes
+  them at their offsets, both concurrently. Upon return, the file position
+  follows the AND gates. Returns 1 if successful.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_AigerWriteAndsPar( Gia_Man_t * p, FILE * pFile, int nProcs )
+{
+    Gia_AigQueue_t Queue, * q = &Queue;
+    size_t Offset;
+    int i, RetValue = 1;
+    assert( Gia_ManIsNormalized(p) );
+    memset( q, 0, sizeof(Gia_AigQueue_t) );
+    q->p       = p;
+    q->pChunks = Gia_AigerDeriveChunks( 1 + Gia_ManCiNum(p), Gia_ManAndNum(p), nProcs, &q->nChunks );
+    // compute the sizes of the chunks
+    q->Pass = 0;
+    Gia_AigerProcessChunks( q, nProcs );
+    fflush( pFile );
+    Offset = (size_t)ftell( pFile );
+    for ( i = 0; i < q->nChunks; i++ )
+    {
+        q->pChunks[i].Offset = Offset;
+        Offset += q->pChunks[i].nBytes;
+    }
+#ifdef _WIN32
+    // write the chunks in the order, because positional writes are not available
+    for ( i = 0; i < q->nChunks; i++ )
+    {
+        unsigned char * pBuffer = ABC_ALLOC( unsigned char, Abc_MaxInt((int)q->pChunks[i].nBytes, 1) );
+        Gia_AigerChunkEncode( p, q->pChunks + i, pBuffer );
+        RetValue &= (fwrite( pBuffer, 1, q->pChunks[i].nBytes, pFile ) == q->pChunks[i].nBytes);
+        ABC_FREE( pBuffer );
+    }
+#else
+    // encode the chunks and write them at their offsets
+    q->fd   = fileno( pFile );
+    q->Pass = 1;
+    Gia_AigerProcessChunks( q, nProcs );
+    for ( i = 0; i < q->nChunks; i++ )
+        RetValue &= q->pChunks[i].Status;
+    fseek( pFile, (long)Offset, SEEK_SET );
+#endif
+    ABC_FREE( q->pChunks );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AND gates into the AIG without structural hashing.]
+
+  Description [The AIG should contain the constant and the CIs, and have
+  room for the AND gates. A quick scan finds the beginnings of the chunks
+  of the AND gates, which are then decoded concurrently into the objects.
+  Returns the position following the AND gates.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned char * Gia_AigerReadAndsPar( Gia_Man_t * p, unsigned char * pCur, int nAnds, int nProcs )
+{
+    Gia_AigQueue_t Queue, * q = &Queue;
+    int i, nEnds;
+    assert( Gia_ManObjNum(p) == 1 + Gia_ManCiNum(p) );
+    assert( p->nObjsAlloc >= Gia_ManObjNum(p) + nAnds );
+    assert( !p->pFanData && !p->fSweeper && !p->fBuiltInSim && !p->vSuppWords && !Vec_IntSize(&p->vHTable) );
+    memset( q, 0, sizeof(Gia_AigQueue_t) );
+    q->p       = p;
+    q->Pass    = 2;
+    q->pChunks = Gia_AigerDeriveChunks( Gia_ManObjNum(p), nAnds, nProcs, &q->nChunks );
+    // find the beginnings of the chunks (each AND gate is two numbers)
+    for ( i = 0; i < q->nChunks; i++ )
+    {
+        q->pChunks[i].pBeg = pCur;
+        for ( nEnds = 2 * (q->pChunks[i].iEnd - q->pChunks[i].iBeg); nEnds; pCur++ )
+            nEnds -= !(*pCur & 0x80);
+    }
+    // decode the chunks
+    Gia_AigerProcessChunks( q, nProcs );
+    p->nObjs += nAnds;
+    for ( i = 0; i < q->nChunks; i++ )
+        p->nBufs += q->pChunks[i].nBufs;
+    ABC_FREE( q->pChunks );
+    return pCur;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
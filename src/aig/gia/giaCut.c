@@ -638,6 +638,40 @@ void Gia_StoComputeCuts( Gia_Man_t * pGia )
     Gia_StoFree( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of an object appended to the AIG.]
+
+  Description [Allows for computing the cuts while the AIG is being
+  constructed, assuming that the cuts of the fanins are known. The cut
+  set of an object is the number of cuts followed by the cuts, each being
+  the number of leaves, the leaves, and the function ID. The trivial cut
+  of an internal node comes last.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_StoComputeCutsObj( Gia_Sto_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    while ( Vec_IntSize(p->vRefs) <= iObj )
+        Gia_StoRefObj( p, Vec_IntSize(p->vRefs) );
+    while ( Vec_WecSize(p->vCuts) <= iObj )
+        Vec_WecPushLevel( p->vCuts );
+    if ( iObj == 0 )
+        Gia_StoComputeCutsConst0( p, iObj );
+    else if ( Gia_ObjIsCi(pObj) )
+        Gia_StoComputeCutsCi( p, iObj );
+    else if ( Gia_ObjIsAnd(pObj) )
+        Gia_StoComputeCutsNode( p, iObj );
+}
+Vec_Int_t * Gia_StoCutSet( Gia_Sto_t * p, int iObj )
+{
+    return Vec_WecEntry( p->vCuts, iObj );
+}
+
 
 /**Function*************************************************************
 
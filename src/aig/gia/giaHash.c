@@ -27,6 +27,16 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// The table uses open addressing with linear probing. Each slot is a triple
+// of integers (iLit0, iLit1, iObj), so the probe compares the fanin literals
+// without touching the object array. The slot is empty when iObj is 0.
+// The number of slots is a power of 2 and the load factor is kept below 3/4.
+// When the table is resized, the old table is kept in p->vHash and its slots 
+// are moved into the new table a few at a time by the following insertions.
+
+#define GIA_HASH_SLOT   3     // the number of integers in one slot
+#define GIA_HASH_MOVE  16     // the number of old slots moved by one insertion
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -35,36 +45,61 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Returns the place where this node is stored (or should be stored).]
 
-  Description []
+  Description [The lookup does not change the table. If the node is not
+  found, the returned place is the empty slot of the current table, which
+  is filled by Gia_ManHashInsert() when the node is added.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
+static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int Mask ) 
+{
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1 + (unsigned)iLit1 * 0x85EBCA6B + (unsigned)iLitC * 0xC2B2AE35;
+    Key ^= Key >> 15;
+    Key *= 0x2C1B3C6D;
+    Key ^= Key >> 12;
+    return (int)(Key & Mask);
+}
+static inline int Gia_ManHashSlotNum( Vec_Int_t * vTable )
+{
+    return Vec_IntSize(vTable) / GIA_HASH_SLOT;
+}
+static inline int * Gia_ManHashProbe( Gia_Man_t * p, Vec_Int_t * vTable, int iLit0, int iLit1, int iLitC )
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    int Mask = Gia_ManHashSlotNum(vTable) - 1;
+    int i = Gia_ManHashOne( iLit0, iLit1, iLitC, Mask );
+    int * pSlot = Vec_IntArray(vTable) + GIA_HASH_SLOT * i;
+    for ( ; pSlot[2]; i = (i + 1) & Mask, pSlot = Vec_IntArray(vTable) + GIA_HASH_SLOT * i )
+        if ( pSlot[0] == iLit0 && pSlot[1] == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, pSlot[2]) == iLitC) )
+            break;
+    return pSlot;
 }
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    int * pSlot, * pSlotOld;
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
     assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
+    pSlot = Gia_ManHashProbe( p, &p->vHTable, iLit0, iLit1, iLitC );
+    if ( pSlot[2] )
+        return pSlot + 2;
+    // the node may be in the old table, which is still being moved
+    if ( Vec_IntSize(&p->vHash) )
     {
-        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
-        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
-            break;
+        pSlotOld = Gia_ManHashProbe( p, &p->vHash, iLit0, iLit1, iLitC );
+        if ( pSlotOld[2] )
+            return pSlotOld + 2;
     }
-    return pPlace;
+    return pSlot + 2;
+}
+static inline int Gia_ManHashInsert( int * pPlace, int iLit0, int iLit1, int iNode )
+{
+    assert( pPlace[0] == 0 && iNode > 0 );
+    pPlace[-2] = iLit0;
+    pPlace[-1] = iLit1;
+    return pPlace[0] = iNode;
 }
 
 /**Function*************************************************************
@@ -104,11 +139,12 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
+    int nEntries = Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc;
     assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
-    Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
-//printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
+    assert( Vec_IntSize(&p->vHash) == 0 );
+    Vec_IntFill( &p->vHTable, GIA_HASH_SLOT * (1 << Abc_Base2Log(Abc_MaxInt(4 * nEntries / 3, 1 << 10))), 0 );
+    p->iHashMove = 0;
+//printf( "Alloced table with %d entries.\n", Gia_ManHashSlotNum(&p->vHTable) );
 }
 
 /**Function*************************************************************
@@ -130,8 +166,7 @@ void Gia_ManHashStart( Gia_Man_t * p )
     Gia_ManForEachAnd( p, pObj, i )
     {
         pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), Gia_ObjFaninLit2(p, i) );
-        assert( *pPlace == 0 );
-        *pPlace = i;
+        Gia_ManHashInsert( pPlace, Gia_ObjFaninLit0(pObj, i), Gia_ObjFaninLit1(pObj, i), i );
     }
 }
 
@@ -150,13 +185,48 @@ void Gia_ManHashStop( Gia_Man_t * p )
 {
     Vec_IntErase( &p->vHTable );
     Vec_IntErase( &p->vHash );
+    p->iHashMove = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the given number of slots of the old table.]
+
+  Description [The old table is freed when all of its slots are moved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManHashMove( Gia_Man_t * p, int nSlots )
+{
+    int * pSlot, * pPlace;
+    int iStop = Abc_MinInt( p->iHashMove + nSlots, Gia_ManHashSlotNum(&p->vHash) );
+    assert( Vec_IntSize(&p->vHash) > 0 );
+    for ( ; p->iHashMove < iStop; p->iHashMove++ )
+    {
+        pSlot = Vec_IntEntryP( &p->vHash, GIA_HASH_SLOT * p->iHashMove );
+        if ( pSlot[2] == 0 )
+            continue;
+        pPlace = Gia_ManHashProbe( p, &p->vHTable, pSlot[0], pSlot[1], Gia_ObjFaninLit2(p, pSlot[2]) );
+        assert( pPlace[2] == 0 ); // should not be there
+        pPlace[0] = pSlot[0];
+        pPlace[1] = pSlot[1];
+        pPlace[2] = pSlot[2];
+    }
+    if ( p->iHashMove < Gia_ManHashSlotNum(&p->vHash) )
+        return;
+    Vec_IntErase( &p->vHash );
+    p->iHashMove = 0;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Resizes the hash table.]
 
-  Description []
+  Description [Doubles the number of slots. The entries of the old table
+  are moved into the new one incrementally by Gia_ManHashReserve().]
                
   SideEffects []
 
@@ -165,39 +235,45 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
+    assert( Vec_IntSize(&p->vHTable) > 0 );
+    // finish the previous resizing
+    if ( Vec_IntSize(&p->vHash) )
+        Gia_ManHashMove( p, Gia_ManHashSlotNum(&p->vHash) );
     // replace the table
+    p->vHash = p->vHTable;
     Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
-    // rehash the entries from the old table
-    Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
-    Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
-    assert( Counter == Counter2 );
+    Vec_IntFill( &p->vHTable, 2 * Vec_IntSize(&p->vHash), 0 ); 
+    p->iHashMove = 0;
 //    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
+//        printf( "Resizing GIA hash table: %d -> %d.\n", Gia_ManHashSlotNum(&p->vHash), Gia_ManHashSlotNum(&p->vHTable) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes sure that the table has room for one more entry.]
+
+  Description [Should be called before looking up the node that may be 
+  added, because moving the old slots may fill the returned empty slot.
+  The number of ANDs is an upper bound on the number of entries.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManHashReserve( Gia_Man_t * p )
+{
+    if ( Vec_IntSize(&p->vHash) )
+        Gia_ManHashMove( p, GIA_HASH_MOVE );
+    else if ( 4 * (Gia_ManAndNum(p) + 1) > 3 * Gia_ManHashSlotNum(&p->vHTable) )
+        Gia_ManHashResize( p );
 }
 
 /**Function********************************************************************
 
   Synopsis    [Profiles the hash table.]
 
-  Description []
+  Description [Prints the histogram of the lengths of the probe sequences.]
 
   SideEffects []
 
@@ -206,21 +282,25 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    int iEntry;
-    int i, Counter, Limit;
-    printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
+    int i, k, iLit2, nSlots = Gia_ManHashSlotNum(&p->vHTable);
+    int Counts[16] = {0}, nEntries = 0;
+    int * pSlot;
+    printf( "Table size = %d. Entries = %d. ", nSlots, Gia_ManAndNum(p) );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
-    for ( i = 0; i < Limit; i++ )
+    for ( i = 0; i < nSlots; i++ )
     {
-        Counter = 0;
-        for ( iEntry = Vec_IntEntry(&p->vHTable, i); 
-              iEntry; 
-              iEntry = iEntry? Vec_IntEntry(&p->vHash, iEntry) : 0 )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        pSlot = Vec_IntEntryP( &p->vHTable, GIA_HASH_SLOT * i );
+        if ( pSlot[2] == 0 )
+            continue;
+        iLit2 = Gia_ObjFaninLit2( p, pSlot[2] );
+        k = (i - Gia_ManHashOne( pSlot[0], pSlot[1], iLit2, nSlots - 1 )) & (nSlots - 1);
+        Counts[Abc_MinInt(k, 15)]++;
+        nEntries++;
     }
+    printf( "Used slots = %d. Probe lengths: ", nEntries );
+    for ( i = 0; i < 16; i++ )
+        if ( Counts[i] ) 
+            printf( "%s%d=%d ", i == 15 ? ">=":"", i + 1, Counts[i] );
     printf( "\n" );
 }
 
@@ -478,8 +558,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashReserve( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     if ( Abc_LitIsCompl(iLit0) )
@@ -494,15 +573,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        Gia_ManHashInsert( pPlace, iLit0, iLit1, Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -541,6 +612,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
     if ( Abc_LitIsCompl(iLit1) )
         iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+    Gia_ManHashReserve( p );
     {
         int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
         if ( *pPlace )
@@ -549,15 +621,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        Gia_ManHashInsert( pPlace, iLit0, iLit1, Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -588,8 +652,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashReserve( p );
     if ( p->fAddStrash )
     {
         Gia_Obj_t * pObj = Gia_ManAddStrash( p, Gia_ObjFromLit(p, iLit0), Gia_ObjFromLit(p, iLit1) );
@@ -606,15 +669,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        Gia_ManHashInsert( pPlace, iLit0, iLit1, Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) ) );
         return Abc_Var2Lit( *pPlace, 0 );
     }
 }
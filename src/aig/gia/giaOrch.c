@@ -0,0 +1,835 @@
+/**CFile****************************************************************
+
+  FileName    [giaOrch.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Orchestration of rewriting, refactoring and resubstitution.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+#include "bool/kit/kit.h"
+#include "bool/dec/dec.h"
+#include "opt/rwr/rwr.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define GIA_ORCH_RW_CUT   4      // the cut size used by rewriting
+#define GIA_ORCH_RW_NUM   10     // the max number of cuts per node
+#define GIA_ORCH_DIV_MAX  150    // the max number of resubstitution divisors
+#define GIA_ORCH_CONE_MAX 16     // the max number of nodes visited by the refactoring cut
+
+enum { GIA_ORCH_RW, GIA_ORCH_RS, GIA_ORCH_RF, GIA_ORCH_NONE };
+
+// The resulting AIG is constructed while visiting the nodes of the original
+// AIG in a topological order. The reference counter of a resulting node is
+// the number of its fanouts plus the number of fanouts of the original
+// nodes mapped into it that are not visited yet. A node whose counter is
+// zero is dangling; it may be reused by later nodes and is removed at the
+// end otherwise.
+//
+// A candidate is stored as an integer array: the number of leaves, the
+// leaves, the fanin literal pairs of the AND gates, and the output literal.
+// Literals use a local numbering: variable 0 is const0, variables
+// 1..nLeaves are the leaves, and the following variables are the gates.
+
+typedef struct Gia_Sto_t_ Gia_Sto_t;
+
+typedef struct Gia_OrchMan_t_ Gia_OrchMan_t;
+struct Gia_OrchMan_t_
+{
+    // parameters
+    int            nCutSizeRs;    // the cut size for resubstitution
+    int            nNodesRs;      // the max number of nodes added by resubstitution
+    int            nCutSizeRf;    // the cut size for refactoring
+    int            fUseZerosRw;   // accepts zero-cost rewriting
+    int            fUseZerosRf;   // accepts zero-cost refactoring
+    int            fVerbose;      // verbose stats
+    int            fVeryVerbose;  // prints every accepted change
+    // the AIGs
+    Gia_Man_t *    pGia;          // the original AIG
+    Gia_Man_t *    pNew;          // the resulting AIG under construction
+    Gia_Sto_t *    pSto;          // the cuts of the resulting AIG used by rewriting
+    Rwr_Man_t *    pManRwr;       // the library of rewriting subgraphs
+    Vec_Int_t *    vRefs;         // the reference counters of the resulting nodes
+    Vec_Wec_t *    vFanouts;      // the fanouts of the resulting nodes
+    // the current window
+    Vec_Int_t *    vLeaves;       // the cut leaves
+    Vec_Int_t *    vWin;          // the window nodes in a topological order
+    Vec_Wrd_t *    vSims;         // the truth tables of the window nodes
+    Vec_Ptr_t *    vDivs;         // the truth tables of resubstitution divisors
+    Vec_Int_t *    vDivIds;       // the nodes of resubstitution divisors
+    Vec_Int_t *    vCand;         // the current candidate
+    Vec_Int_t *    vBest;         // the best candidate
+    Vec_Int_t *    vLits;         // the literals of the candidate gates
+    Vec_Int_t *    vGates;        // the fanin literals of the candidate gates
+    Vec_Int_t *    vMarks;        // the candidate gates to be added
+    Vec_Int_t *    vMemory;       // the memory for ISOP computation
+    word           pTruth[2][1 << 10]; // the on-set and the off-set
+    // statistics
+    int            nTried[3];
+    int            nChanges[3];
+    int            nGains[3];
+    abctime        clkOps[3];
+};
+
+extern Gia_Sto_t * Gia_StoAlloc( Gia_Man_t * pGia, int nCutSize, int nCutNum, int fCutMin, int fTruthMin, int fVerbose );
+extern void Gia_StoFree( Gia_Sto_t * p );
+extern void Gia_StoComputeCutsObj( Gia_Sto_t * p, int iObj );
+extern Vec_Int_t * Gia_StoCutSet( Gia_Sto_t * p, int iObj );
+extern void Abc_ResubPrepareManager( int nWords );
+extern int Abc_ResubComputeFunction( void ** ppDivs, int nDivs, int nWords, int nLimit, int nDivsMax, int iChoice, int fUseXor, int fDebug, int fVerbose, int ** ppArray );
+
+static inline int    Gia_OrchRefNum( Gia_OrchMan_t * p, int iObj )           { return Vec_IntEntry(p->vRefs, iObj);                                  }
+static inline int    Gia_OrchIsAlive( Gia_OrchMan_t * p, int iObj )          { return !Gia_ObjIsAnd(Gia_ManObj(p->pNew, iObj)) || Gia_OrchRefNum(p, iObj) > 0; }
+static inline int    Gia_OrchSimWords( int nVars )                           { return Abc_TtWordNum(nVars);                                          }
+static inline word * Gia_OrchSim( Gia_OrchMan_t * p, int iPos, int nWords )  { return Vec_WrdEntryP(p->vSims, iPos * nWords);                       }
+static inline int    Gia_OrchCandGateNum( Vec_Int_t * vCand )                { return (Vec_IntSize(vCand) - Vec_IntEntry(vCand, 0) - 2) / 2;         }
+
+// iterates through the cuts of a cut set
+#define Gia_OrchForEachCut( pList, pCut, i ) for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += pCut[0] + 2 )
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Dereferences and references the node.]
+
+  Description [Dereferencing returns the number of AND gates freed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_OrchDeref_rec( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    int iFan0 = Gia_ObjFaninId0( pObj, iObj );
+    int iFan1 = Gia_ObjFaninId1( pObj, iObj );
+    int Counter = 1;
+    assert( Gia_ObjIsAnd(pObj) );
+    Vec_IntAddToEntry( p->vRefs, iFan0, -1 );
+    if ( !Gia_OrchIsAlive(p, iFan0) )
+        Counter += Gia_OrchDeref_rec( p, iFan0 );
+    Vec_IntAddToEntry( p->vRefs, iFan1, -1 );
+    if ( !Gia_OrchIsAlive(p, iFan1) )
+        Counter += Gia_OrchDeref_rec( p, iFan1 );
+    return Counter;
+}
+void Gia_OrchRef_rec( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    int iFan0 = Gia_ObjFaninId0( pObj, iObj );
+    int iFan1 = Gia_ObjFaninId1( pObj, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    if ( !Gia_OrchIsAlive(p, iFan0) )
+        Gia_OrchRef_rec( p, iFan0 );
+    Vec_IntAddToEntry( p->vRefs, iFan0, 1 );
+    if ( !Gia_OrchIsAlive(p, iFan1) )
+        Gia_OrchRef_rec( p, iFan1 );
+    Vec_IntAddToEntry( p->vRefs, iFan1, 1 );
+}
+// references the fanins of a dangling node before it is reused
+static inline void Gia_OrchRevive( Gia_OrchMan_t * p, int iObj )
+{
+    if ( !Gia_OrchIsAlive(p, iObj) )
+        Gia_OrchRef_rec( p, iObj );
+}
+// removes one reference and dereferences the node if it becomes dangling
+static inline void Gia_OrchRelease( Gia_OrchMan_t * p, int iObj )
+{
+    Vec_IntAddToEntry( p->vRefs, iObj, -1 );
+    if ( !Gia_OrchIsAlive(p, iObj) )
+        Gia_OrchDeref_rec( p, iObj );
+}
+// counts the dangling nodes to be reused together with the node
+int Gia_OrchDeadCone_rec( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj;
+    if ( Gia_OrchIsAlive(p, iObj) || Gia_ObjIsTravIdCurrentId(p->pNew, iObj) )
+        return 0;
+    Gia_ObjSetTravIdCurrentId( p->pNew, iObj );
+    pObj = Gia_ManObj( p->pNew, iObj );
+    return 1 + Gia_OrchDeadCone_rec( p, Gia_ObjFaninId0(pObj, iObj) ) + Gia_OrchDeadCone_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+}
+// pins the leaves and dereferences the node; returns the MFFC size
+int Gia_OrchMffcStart( Gia_OrchMan_t * p, int iNode, Vec_Int_t * vLeaves, int nRefs )
+{
+    int i, iLeaf;
+    Vec_IntForEachEntry( vLeaves, iLeaf, i )
+        Vec_IntAddToEntry( p->vRefs, iLeaf, 1 );
+    Vec_IntAddToEntry( p->vRefs, iNode, -nRefs );
+    assert( Gia_OrchRefNum(p, iNode) == 0 );
+    return Gia_OrchDeref_rec( p, iNode );
+}
+void Gia_OrchMffcStop( Gia_OrchMan_t * p, int iNode, Vec_Int_t * vLeaves, int nRefs )
+{
+    int i, iLeaf;
+    Gia_OrchRef_rec( p, iNode );
+    Vec_IntAddToEntry( p->vRefs, iNode, nRefs );
+    Vec_IntForEachEntry( vLeaves, iLeaf, i )
+        Vec_IntAddToEntry( p->vRefs, iLeaf, -1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds a node to the resulting AIG.]
+
+  Description [Updates the reference counters, the fanouts and the cuts
+  of a new object. The AND gate of two literals is created if it does not
+  exist; the existing dangling node is reused otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_OrchAppendObj( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    assert( iObj == Vec_IntSize(p->vRefs) );
+    Vec_IntPush( p->vRefs, 0 );
+    Vec_WecPushLevel( p->vFanouts );
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId0(pObj, iObj), 1 );
+        Vec_IntAddToEntry( p->vRefs, Gia_ObjFaninId1(pObj, iObj), 1 );
+        Vec_WecPush( p->vFanouts, Gia_ObjFaninId0(pObj, iObj), iObj );
+        Vec_WecPush( p->vFanouts, Gia_ObjFaninId1(pObj, iObj), iObj );
+    }
+    Gia_StoComputeCutsObj( p->pSto, iObj );
+}
+int Gia_OrchHashAnd( Gia_OrchMan_t * p, int iLit0, int iLit1 )
+{
+    int nObjs = Gia_ManObjNum( p->pNew );
+    int iLit = Gia_ManHashAnd( p->pNew, iLit0, iLit1 );
+    if ( Abc_Lit2Var(iLit) >= nObjs )
+        Gia_OrchAppendObj( p, Abc_Lit2Var(iLit) );
+    else
+        Gia_OrchRevive( p, Abc_Lit2Var(iLit) );
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_OrchMan_t * Gia_OrchManStart( Gia_Man_t * pGia, int nCutSizeRs, int nNodesRs, int nCutSizeRf, int fUseZerosRw, int fUseZerosRf, int fVerbose, int fVeryVerbose )
+{
+    Gia_OrchMan_t * p = ABC_CALLOC( Gia_OrchMan_t, 1 );
+    Gia_Obj_t * pObj; int i;
+    p->nCutSizeRs   = nCutSizeRs;
+    p->nNodesRs     = nNodesRs;
+    p->nCutSizeRf   = nCutSizeRf;
+    p->fUseZerosRw  = fUseZerosRw;
+    p->fUseZerosRf  = fUseZerosRf;
+    p->fVerbose     = fVerbose;
+    p->fVeryVerbose = fVeryVerbose;
+    p->pGia         = pGia;
+    p->pNew         = Gia_ManStart( Gia_ManObjNum(pGia) );
+    p->pNew->pName  = Abc_UtilStrsav( pGia->pName );
+    p->pNew->pSpec  = Abc_UtilStrsav( pGia->pSpec );
+    Gia_ManFillValue( pGia );
+    Gia_ManConst0(pGia)->Value = 0;
+    Gia_ManForEachCi( pGia, pObj, i )
+        pObj->Value = Gia_ManAppendCi( p->pNew );
+    Gia_ManHashAlloc( p->pNew );
+    p->pSto         = Gia_StoAlloc( p->pNew, GIA_ORCH_RW_CUT, GIA_ORCH_RW_NUM, 0, 0, 0 );
+    p->pManRwr      = Rwr_ManStart( 0 );
+    p->vRefs        = Vec_IntAlloc( Gia_ManObjNum(pGia) );
+    p->vFanouts     = Vec_WecAlloc( Gia_ManObjNum(pGia) );
+    for ( i = 0; i < Gia_ManObjNum(p->pNew); i++ )
+        Gia_OrchAppendObj( p, i );
+    p->vLeaves      = Vec_IntAlloc( 16 );
+    p->vWin         = Vec_IntAlloc( 256 );
+    p->vSims        = Vec_WrdAlloc( 1 << 12 );
+    p->vDivs        = Vec_PtrAlloc( 256 );
+    p->vDivIds      = Vec_IntAlloc( 256 );
+    p->vCand        = Vec_IntAlloc( 256 );
+    p->vBest        = Vec_IntAlloc( 256 );
+    p->vLits        = Vec_IntAlloc( 256 );
+    p->vGates       = Vec_IntAlloc( 256 );
+    p->vMarks       = Vec_IntAlloc( 256 );
+    p->vMemory      = Vec_IntAlloc( 1 << 16 );
+    Gia_ManCreateRefs( pGia );
+    Abc_ResubPrepareManager( Gia_OrchSimWords(nCutSizeRs) );
+    return p;
+}
+void Gia_OrchManStop( Gia_OrchMan_t * p )
+{
+    Abc_ResubPrepareManager( 0 );
+    if ( p->pNew )
+        Gia_ManStop( p->pNew );
+    Gia_StoFree( p->pSto );
+    Rwr_ManStop( p->pManRwr );
+    Vec_IntFree( p->vRefs );
+    Vec_WecFree( p->vFanouts );
+    Vec_IntFree( p->vLeaves );
+    Vec_IntFree( p->vWin );
+    Vec_WrdFree( p->vSims );
+    Vec_PtrFree( p->vDivs );
+    Vec_IntFree( p->vDivIds );
+    Vec_IntFree( p->vCand );
+    Vec_IntFree( p->vBest );
+    Vec_IntFree( p->vLits );
+    Vec_IntFree( p->vGates );
+    Vec_IntFree( p->vMarks );
+    Vec_IntFree( p->vMemory );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the reconvergence-driven cut of the node.]
+
+  Description [Stops expanding the cut when it has too many leaves or
+  when the cone has too many nodes. Returns 0 if the cut cannot be
+  computed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_OrchLeafCost( Gia_OrchMan_t * p, int iLeaf )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iLeaf );
+    if ( !Gia_ObjIsAnd(pObj) )
+        return ABC_INFINITY;
+    return !Gia_ObjIsTravIdCurrentId(p->pNew, Gia_ObjFaninId0(pObj, iLeaf)) +
+           !Gia_ObjIsTravIdCurrentId(p->pNew, Gia_ObjFaninId1(pObj, iLeaf)) - 1;
+}
+int Gia_OrchReconvCut( Gia_OrchMan_t * p, int iNode, int nLeavesMax, int nConeMax )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iNode );
+    int i, iLeaf, iBest, Cost, CostBest, iFan, nVisited = 3;
+    Vec_IntClear( p->vLeaves );
+    Gia_ManIncrementTravId( p->pNew );
+    Gia_ObjSetTravIdCurrentId( p->pNew, iNode );
+    Vec_IntPush( p->vLeaves, Gia_ObjFaninId0(pObj, iNode) );
+    Vec_IntPush( p->vLeaves, Gia_ObjFaninId1(pObj, iNode) );
+    Gia_ObjSetTravIdCurrentId( p->pNew, Gia_ObjFaninId0(pObj, iNode) );
+    Gia_ObjSetTravIdCurrentId( p->pNew, Gia_ObjFaninId1(pObj, iNode) );
+    while ( 1 )
+    {
+        iBest = -1;  CostBest = ABC_INFINITY;
+        Vec_IntForEachEntry( p->vLeaves, iLeaf, i )
+        {
+            Cost = Gia_OrchLeafCost( p, iLeaf );
+            if ( CostBest > Cost )
+                CostBest = Cost, iBest = i;
+        }
+        if ( iBest == -1 || Vec_IntSize(p->vLeaves) + CostBest > nLeavesMax || nVisited + 2 > nConeMax )
+            break;
+        iLeaf = Vec_IntEntry( p->vLeaves, iBest );
+        pObj  = Gia_ManObj( p->pNew, iLeaf );
+        Vec_IntDrop( p->vLeaves, iBest );
+        iFan = Gia_ObjFaninId0( pObj, iLeaf );
+        if ( !Gia_ObjIsTravIdCurrentId(p->pNew, iFan) )
+            Vec_IntPush( p->vLeaves, iFan ), Gia_ObjSetTravIdCurrentId( p->pNew, iFan ), nVisited++;
+        iFan = Gia_ObjFaninId1( pObj, iLeaf );
+        if ( !Gia_ObjIsTravIdCurrentId(p->pNew, iFan) )
+            Vec_IntPush( p->vLeaves, iFan ), Gia_ObjSetTravIdCurrentId( p->pNew, iFan ), nVisited++;
+    }
+    if ( Vec_IntSize(p->vLeaves) > nLeavesMax )
+        return 0;
+    Vec_IntSort( p->vLeaves, 0 );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes truth tables of the window rooted in the node.]
+
+  Description [The truth tables are expressed using the cut leaves. The
+  position of an object in the window is kept in its Value field.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_OrchWindowSimNode( Gia_OrchMan_t * p, int iObj, int nWords )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pNew, iObj );
+    word * pSim, * pSim0, * pSim1;
+    pObj->Value = Vec_IntSize( p->vWin );
+    Vec_IntPush( p->vWin, iObj );
+    Vec_WrdFillExtra( p->vSims, Vec_IntSize(p->vWin) * nWords, 0 );
+    pSim = Gia_OrchSim( p, pObj->Value, nWords );
+    pSim0 = Gia_OrchSim( p, Gia_ObjFanin0(pObj)->Value, nWords );
+    pSim1 = Gia_OrchSim( p, Gia_ObjFanin1(pObj)->Value, nWords );
+    Abc_TtAndCompl( pSim, pSim0, Gia_ObjFaninC0(pObj), pSim1, Gia_ObjFaninC1(pObj), nWords );
+}
+void Gia_OrchWindowSim_rec( Gia_OrchMan_t * p, int iObj, int nWords )
+{
+    Gia_Obj_t * pObj;
+    if ( Gia_ObjIsTravIdCurrentId(p->pNew, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId( p->pNew, iObj );
+    pObj = Gia_ManObj( p->pNew, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_OrchWindowSim_rec( p, Gia_ObjFaninId0(pObj, iObj), nWords );
+    Gia_OrchWindowSim_rec( p, Gia_ObjFaninId1(pObj, iObj), nWords );
+    Gia_OrchWindowSimNode( p, iObj, nWords );
+}
+word * Gia_OrchWindowSim( Gia_OrchMan_t * p, int iNode, Vec_Int_t * vLeaves, int nVars )
+{
+    int i, iLeaf, nWords = Gia_OrchSimWords( nVars );
+    Vec_IntClear( p->vWin );
+    Vec_WrdFill( p->vSims, Vec_IntSize(vLeaves) * nWords, 0 );
+    Gia_ManIncrementTravId( p->pNew );
+    Vec_IntForEachEntry( vLeaves, iLeaf, i )
+    {
+        Gia_ObjSetTravIdCurrentId( p->pNew, iLeaf );
+        Gia_ManObj(p->pNew, iLeaf)->Value = i;
+        Vec_IntPush( p->vWin, iLeaf );
+        Abc_TtIthVar( Gia_OrchSim(p, i, nWords), i, nVars );
+    }
+    Gia_OrchWindowSim_rec( p, iNode, nWords );
+    return Gia_OrchSim( p, Gia_ManObj(p->pNew, iNode)->Value, nWords );
+}
+// adds the used nodes whose fanins are in the window
+void Gia_OrchWindowExpand( Gia_OrchMan_t * p, int nVars, int nNodesMax )
+{
+    int i, k, iObj, iFan, nWords = Gia_OrchSimWords( nVars );
+    for ( i = 0; i < Vec_IntSize(p->vWin) && Vec_IntSize(p->vWin) < nNodesMax; i++ )
+    {
+        iObj = Vec_IntEntry( p->vWin, i );
+        Vec_IntForEachEntry( Vec_WecEntry(p->vFanouts, iObj), iFan, k )
+        {
+            Gia_Obj_t * pFan = Gia_ManObj( p->pNew, iFan );
+            if ( Gia_ObjIsTravIdCurrentId(p->pNew, iFan) || !Gia_OrchIsAlive(p, iFan) )
+                continue;
+            if ( !Gia_ObjIsTravIdCurrentId(p->pNew, Gia_ObjFaninId0(pFan, iFan)) || !Gia_ObjIsTravIdCurrentId(p->pNew, Gia_ObjFaninId1(pFan, iFan)) )
+                continue;
+            Gia_ObjSetTravIdCurrentId( p->pNew, iFan );
+            Gia_OrchWindowSimNode( p, iFan, nWords );
+            if ( Vec_IntSize(p->vWin) == nNodesMax )
+                break;
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the candidate into the resulting AIG.]
+
+  Description [The gates of the candidate that exist in the resulting AIG
+  are reused; the other gates get the variables following the last node.
+  Fills in the literals of the gates (p->vLits), their fanin literals
+  (p->vGates) and the marks of the new gates used by the output
+  (p->vMarks). Returns the output literal.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_OrchCandLit( Gia_OrchMan_t * p, Vec_Int_t * vCand, int Lit )
+{
+    int iVar = Abc_Lit2Var( Lit ), nLeaves = Vec_IntEntry( vCand, 0 );
+    if ( iVar == 0 )
+        return Lit;
+    if ( iVar <= nLeaves )
+        return Abc_Var2Lit( Vec_IntEntry(vCand, iVar), Abc_LitIsCompl(Lit) );
+    return Abc_LitNotCond( Vec_IntEntry(p->vLits, iVar - nLeaves - 1), Abc_LitIsCompl(Lit) );
+}
+int Gia_OrchResolve( Gia_OrchMan_t * p, Vec_Int_t * vCand )
+{
+    int nObjs = Gia_ManObjNum( p->pNew ), nLeaves = Vec_IntEntry( vCand, 0 );
+    int nGates = Gia_OrchCandGateNum( vCand );
+    int i, k, iLit0, iLit1, iLit, iTop;
+    Vec_IntClear( p->vLits );
+    Vec_IntClear( p->vGates );
+    for ( k = 0, i = nLeaves + 1; k < nGates; k++, i += 2 )
+    {
+        iLit0 = Gia_OrchCandLit( p, vCand, Vec_IntEntry(vCand, i) );
+        iLit1 = Gia_OrchCandLit( p, vCand, Vec_IntEntry(vCand, i+1) );
+        if ( iLit0 > iLit1 )
+            iLit = iLit0, iLit0 = iLit1, iLit1 = iLit;
+        Vec_IntPushTwo( p->vGates, iLit0, iLit1 );
+        if ( iLit0 == 0 || iLit0 == Abc_LitNot(iLit1) )
+            iLit = 0;
+        else if ( iLit0 == 1 || iLit0 == iLit1 )
+            iLit = iLit1;
+        else
+        {
+            // literals below 2*nObjs point to existing nodes, others to new gates
+            iLit = iLit1 < 2 * nObjs ? Gia_ManHashLookupInt( p->pNew, iLit0, iLit1 ) : 0;
+            if ( iLit == 0 )
+                iLit = Abc_Var2Lit( nObjs + k, 0 );
+        }
+        Vec_IntPush( p->vLits, iLit );
+    }
+    iTop = Gia_OrchCandLit( p, vCand, Vec_IntEntryLast(vCand) );
+    // mark the new gates used by the output
+    Vec_IntFill( p->vMarks, nGates, 0 );
+    if ( Abc_Lit2Var(iTop) >= nObjs )
+        Vec_IntWriteEntry( p->vMarks, Abc_Lit2Var(iTop) - nObjs, 1 );
+    for ( k = nGates - 1; k >= 0; k-- )
+        if ( Vec_IntEntry(p->vMarks, k) )
+            for ( i = 0; i < 2; i++ )
+                if ( Abc_Lit2Var(Vec_IntEntry(p->vGates, 2*k+i)) >= nObjs )
+                    Vec_IntWriteEntry( p->vMarks, Abc_Lit2Var(Vec_IntEntry(p->vGates, 2*k+i)) - nObjs, 1 );
+    return iTop;
+}
+// returns the number of nodes added to the resulting AIG by the candidate
+int Gia_OrchEvaluate( Gia_OrchMan_t * p, Vec_Int_t * vCand )
+{
+    int nObjs = Gia_ManObjNum( p->pNew );
+    int i, k, iObj, iTop = Gia_OrchResolve( p, vCand ), nAdded = 0;
+    Gia_ManIncrementTravId( p->pNew );
+    for ( k = 0; k < Vec_IntSize(p->vMarks); k++ )
+    {
+        if ( !Vec_IntEntry(p->vMarks, k) )
+            continue;
+        nAdded++;
+        for ( i = 0; i < 2; i++ )
+            if ( (iObj = Abc_Lit2Var(Vec_IntEntry(p->vGates, 2*k+i))) < nObjs )
+                nAdded += Gia_OrchDeadCone_rec( p, iObj );
+    }
+    if ( Abc_Lit2Var(iTop) < nObjs )
+        nAdded += Gia_OrchDeadCone_rec( p, Abc_Lit2Var(iTop) );
+    return nAdded;
+}
+// adds the candidate to the resulting AIG and returns its output literal
+int Gia_OrchBuild( Gia_OrchMan_t * p, Vec_Int_t * vCand )
+{
+    int nObjs = Gia_ManObjNum( p->pNew );
+    int i, k, iLit, iTop = Gia_OrchResolve( p, vCand );
+    for ( k = 0; k < Vec_IntSize(p->vMarks); k++ )
+    {
+        if ( !Vec_IntEntry(p->vMarks, k) )
+            continue;
+        for ( i = 0; i < 2; i++ )
+        {
+            iLit = Vec_IntEntry( p->vGates, 2*k+i );
+            if ( Abc_Lit2Var(iLit) >= nObjs )
+                iLit = Abc_LitNotCond( Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit) - nObjs), Abc_LitIsCompl(iLit) );
+            else
+                Gia_OrchRevive( p, Abc_Lit2Var(iLit) );
+            Vec_IntWriteEntry( p->vGates, 2*k+i, iLit );
+        }
+        Vec_IntWriteEntry( p->vLits, k, Gia_OrchHashAnd(p, Vec_IntEntry(p->vGates, 2*k), Vec_IntEntry(p->vGates, 2*k+1)) );
+    }
+    if ( Abc_Lit2Var(iTop) >= nObjs )
+        return Abc_LitNotCond( Vec_IntEntry(p->vLits, Abc_Lit2Var(iTop) - nObjs), Abc_LitIsCompl(iTop) );
+    Gia_OrchRevive( p, Abc_Lit2Var(iTop) );
+    return iTop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the candidate from the decomposition graph.]
+
+  Description [The leaves of the graph are complemented according to the
+  phase and the output is complemented if the last phase bit is set.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_OrchGraphLit( Dec_Graph_t * pGraph, Dec_Edge_t eEdge, unsigned uPhase )
+{
+    int fLeafCompl = (int)eEdge.Node < pGraph->nLeaves && ((uPhase >> eEdge.Node) & 1);
+    return Abc_Var2Lit( 1 + eEdge.Node, eEdge.fCompl ^ fLeafCompl );
+}
+void Gia_OrchGraphCand( Dec_Graph_t * pGraph, int * pLeaves, int nLeaves, unsigned uPhase, Vec_Int_t * vCand )
+{
+    Dec_Node_t * pNode;
+    int i, iLit0, iLit1, iTop;
+    assert( Dec_GraphIsConst(pGraph) || pGraph->nLeaves == nLeaves );
+    Vec_IntClear( vCand );
+    Vec_IntPush( vCand, nLeaves );
+    Vec_IntPushArray( vCand, pLeaves, nLeaves );
+    Dec_GraphForEachNode( pGraph, pNode, i )
+    {
+        iLit0 = Gia_OrchGraphLit( pGraph, pNode->eEdge0, uPhase );
+        iLit1 = Gia_OrchGraphLit( pGraph, pNode->eEdge1, uPhase );
+        Vec_IntPushTwo( vCand, Abc_MinInt(iLit0, iLit1), Abc_MaxInt(iLit0, iLit1) );
+    }
+    iTop = Dec_GraphIsConst(pGraph) ? Dec_GraphIsConst1(pGraph) : Gia_OrchGraphLit( pGraph, pGraph->eRoot, uPhase );
+    Vec_IntPush( vCand, Abc_LitNotCond(iTop, (uPhase >> nLeaves) & 1) );
+}
+// evaluates the candidate and saves it if it is the best one so far
+int Gia_OrchTryCand( Gia_OrchMan_t * p, int nMffc, int * pGainBest )
+{
+    int nAdded = Gia_OrchEvaluate( p, p->vCand );
+    if ( nMffc - nAdded <= *pGainBest )
+        return 0;
+    *pGainBest = nMffc - nAdded;
+    ABC_SWAP( Vec_Int_t *, p->vCand, p->vBest );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates rewriting, refactoring and resubstitution of the node.]
+
+  Description [Each procedure takes the node of the resulting AIG and the
+  number of its references, and leaves the best candidate in p->vBest if
+  it improves the given gain.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_OrchNodeRewrite( Gia_OrchMan_t * p, int iNode, int nRefs, int * pGainBest )
+{
+    int i, k, * pCut, * pList = Vec_IntArray( Gia_StoCutSet(p->pSto, iNode) ), nMffc, nSingles, RetValue = 0;
+    int pLeaves[GIA_ORCH_RW_CUT];
+    Vec_Ptr_t * vSubgraphs;
+    Rwr_Node_t * pSubgraph;
+    unsigned uTruth, uPhase;
+    char * pPerm;
+    Gia_OrchForEachCut( pList, pCut, i )
+    {
+        // consider only 4-input cuts whose leaves are used
+        if ( pCut[0] < GIA_ORCH_RW_CUT )
+            continue;
+        for ( nSingles = 0, k = 1; k <= pCut[0]; k++ )
+        {
+            if ( !Gia_OrchIsAlive(p, pCut[k]) )
+                break;
+            nSingles += Gia_OrchRefNum(p, pCut[k]) == 1;
+        }
+        if ( k <= pCut[0] || nSingles > 2 )
+            continue;
+        Vec_IntClear( p->vLeaves );
+        Vec_IntPushArray( p->vLeaves, pCut + 1, pCut[0] );
+        uTruth = 0xFFFF & (unsigned)*Gia_OrchWindowSim( p, iNode, p->vLeaves, GIA_ORCH_RW_CUT );
+        pPerm  = p->pManRwr->pPerms4[(int)p->pManRwr->pPerms[uTruth]];
+        uPhase = p->pManRwr->pPhases[uTruth];
+        for ( k = 0; k < GIA_ORCH_RW_CUT; k++ )
+            pLeaves[k] = pCut[1 + (int)pPerm[k]];
+        // try the precomputed subgraphs of the NPN class of the cut function
+        nMffc = Gia_OrchMffcStart( p, iNode, p->vLeaves, nRefs );
+        vSubgraphs = Vec_VecEntry( p->pManRwr->vClasses, p->pManRwr->pMap[uTruth] );
+        Vec_PtrForEachEntry( Rwr_Node_t *, vSubgraphs, pSubgraph, k )
+        {
+            Gia_OrchGraphCand( (Dec_Graph_t *)pSubgraph->pNext, pLeaves, GIA_ORCH_RW_CUT, uPhase, p->vCand );
+            RetValue |= Gia_OrchTryCand( p, nMffc, pGainBest );
+        }
+        Gia_OrchMffcStop( p, iNode, p->vLeaves, nRefs );
+    }
+    return RetValue;
+}
+int Gia_OrchNodeRefactor( Gia_OrchMan_t * p, int iNode, int nRefs, int * pGainBest )
+{
+    Dec_Graph_t * pGraph;
+    int nMffc, RetValue = 0;
+    word * pTruth;
+    if ( !Gia_OrchReconvCut(p, iNode, p->nCutSizeRf, GIA_ORCH_CONE_MAX) )
+        return 0;
+    // skip factoring if the gain cannot be improved
+    nMffc = Gia_OrchMffcStart( p, iNode, p->vLeaves, nRefs );
+    if ( nMffc <= *pGainBest )
+    {
+        Gia_OrchMffcStop( p, iNode, p->vLeaves, nRefs );
+        return 0;
+    }
+    pTruth = Gia_OrchWindowSim( p, iNode, p->vLeaves, Vec_IntSize(p->vLeaves) );
+    pGraph = (Dec_Graph_t *)Kit_TruthToGraph( (unsigned *)pTruth, Vec_IntSize(p->vLeaves), p->vMemory );
+    if ( pGraph != NULL )
+    {
+        Gia_OrchGraphCand( pGraph, Vec_IntArray(p->vLeaves), Vec_IntSize(p->vLeaves), 0, p->vCand );
+        Dec_GraphFree( pGraph );
+        RetValue = Gia_OrchTryCand( p, nMffc, pGainBest );
+    }
+    Gia_OrchMffcStop( p, iNode, p->vLeaves, nRefs );
+    return RetValue;
+}
+int Gia_OrchNodeResub( Gia_OrchMan_t * p, int iNode, int nRefs, int * pGainBest )
+{
+    int i, iObj, nMffc, nResub, * pResub, RetValue = 0;
+    int nWords = Gia_OrchSimWords( p->nCutSizeRs );
+    word * pTruth;
+    if ( !Gia_OrchReconvCut(p, iNode, p->nCutSizeRs, ABC_INFINITY) )
+        return 0;
+    nMffc = Gia_OrchMffcStart( p, iNode, p->vLeaves, nRefs );
+    if ( nMffc <= *pGainBest )
+    {
+        Gia_OrchMffcStop( p, iNode, p->vLeaves, nRefs );
+        return 0;
+    }
+    // the divisors are the window nodes outside of the MFFC
+    Gia_OrchWindowSim( p, iNode, p->vLeaves, p->nCutSizeRs );
+    Gia_OrchWindowExpand( p, p->nCutSizeRs, GIA_ORCH_DIV_MAX );
+    pTruth = Gia_OrchSim( p, Gia_ManObj(p->pNew, iNode)->Value, nWords );
+    Abc_TtCopy( p->pTruth[0], pTruth, nWords, 1 );
+    Abc_TtCopy( p->pTruth[1], pTruth, nWords, 0 );
+    Vec_PtrClear( p->vDivs );
+    Vec_PtrPush( p->vDivs, p->pTruth[0] );
+    Vec_PtrPush( p->vDivs, p->pTruth[1] );
+    Vec_IntFill( p->vDivIds, 1, 0 );
+    Vec_IntForEachEntry( p->vWin, iObj, i )
+    {
+        if ( !Gia_OrchIsAlive(p, iObj) )
+            continue;
+        Vec_PtrPush( p->vDivs, Gia_OrchSim(p, i, nWords) );
+        Vec_IntPush( p->vDivIds, iObj );
+    }
+    nResub = Abc_ResubComputeFunction( Vec_PtrArray(p->vDivs), Vec_PtrSize(p->vDivs), nWords, Abc_MinInt(p->nNodesRs, nMffc - 1), GIA_ORCH_DIV_MAX, 0, 0, 0, 0, &pResub );
+    if ( nResub > 0 )
+    {
+        // divisor k >= 2 becomes leaf k-1 and gate j becomes variable nDivs-1+j
+        Vec_IntWriteEntry( p->vDivIds, 0, Vec_IntSize(p->vDivIds) - 1 );
+        Vec_IntClear( p->vCand );
+        Vec_IntAppend( p->vCand, p->vDivIds );
+        for ( i = 0; i < nResub; i++ )
+            Vec_IntPush( p->vCand, Abc_Lit2Var(pResub[i]) < 2 ? pResub[i] : pResub[i] - 2 );
+        RetValue = Gia_OrchTryCand( p, nMffc, pGainBest );
+    }
+    Gia_OrchMffcStop( p, iNode, p->vLeaves, nRefs );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Optimizes the node of the resulting AIG.]
+
+  Description [Returns the literal of the new implementation.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_OrchNode( Gia_OrchMan_t * p, int iNode )
+{
+    char * pNames[3] = { "Rewrite ", "Resub   ", "Refactor" };
+    int k, iType = GIA_ORCH_NONE, Gain, GainBest = -1, iLit, iObj;
+    int nRefs = Gia_OrchRefNum( p, iNode );
+    abctime clk;
+    // the candidates are tried in the order of preference for equal gains
+    for ( k = 0; k < 3; k++ )
+    {
+        clk = Abc_Clock();
+        Gain = GainBest;
+        if ( k == GIA_ORCH_RW )
+            Gia_OrchNodeRewrite( p, iNode, nRefs, &Gain );
+        else if ( k == GIA_ORCH_RS )
+            Gia_OrchNodeResub( p, iNode, nRefs, &Gain );
+        else
+            Gia_OrchNodeRefactor( p, iNode, nRefs, &Gain );
+        p->clkOps[k] += Abc_Clock() - clk;
+        p->nTried[k]++;
+        if ( Gain > GainBest )
+            GainBest = Gain, iType = k;
+    }
+    if ( iType == GIA_ORCH_NONE || (GainBest == 0 && !(iType == GIA_ORCH_RW ? p->fUseZerosRw : iType == GIA_ORCH_RF ? p->fUseZerosRf : 0)) )
+        return Abc_Var2Lit( iNode, 0 );
+    // each improvement of the gain has swapped its candidate into p->vBest
+    iLit = Gia_OrchBuild( p, p->vBest );
+    iObj = Abc_Lit2Var( iLit );
+    if ( iObj == iNode )
+        return iLit;
+    if ( p->fVeryVerbose )
+        printf( "Node %6d : %s  Gain = %2d  Leaves = %d  Gates = %d\n", iNode, pNames[iType], GainBest,
+            Vec_IntEntry(p->vBest, 0), Gia_OrchCandGateNum(p->vBest) );
+    // transfer the references to the new implementation
+    Vec_IntAddToEntry( p->vRefs, iObj, nRefs );
+    Vec_IntAddToEntry( p->vRefs, iNode, -nRefs );
+    assert( Gia_OrchRefNum(p, iNode) == 0 );
+    Gia_OrchDeref_rec( p, iNode );
+    p->nChanges[iType]++;
+    p->nGains[iType] += GainBest;
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Orchestrates rewriting, refactoring and resubstitution.]
+
+  Description [Visits the nodes in a topological order while constructing
+  the resulting AIG. For each node added to the resulting AIG, evaluates
+  rewriting (the precomputed subgraphs of the NPN classes of 4-input cuts),
+  refactoring (factoring the function of a large reconvergence-driven cut)
+  and resubstitution (using the window nodes as divisors), and applies the
+  best of them. The following nodes are constructed on top of the changed
+  logic and may reuse it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManOrchestrate( Gia_Man_t * pInit, int nCutSizeRs, int nNodesRs, int nCutSizeRf, int fUseZerosRw, int fUseZerosRf, int fVerbose, int fVeryVerbose )
+{
+    char * pNames[3] = { "Rewrite ", "Resub   ", "Refactor" };
+    Gia_OrchMan_t * p;
+    Gia_Man_t * pGia, * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    int i, k, iLit, nObjs;
+    abctime clkTotal = Abc_Clock();
+    assert( nCutSizeRs <= 16 && nCutSizeRf <= 16 );
+    assert( pInit->pMuxes == NULL );
+    pGia = Gia_ManRehash( pInit, 0 );
+    p = Gia_OrchManStart( pGia, nCutSizeRs, nNodesRs, nCutSizeRf, fUseZerosRw, fUseZerosRf, fVerbose, fVeryVerbose );
+    Gia_ManForEachAnd( pGia, pObj, i )
+    {
+        nObjs = Gia_ManObjNum( p->pNew );
+        iLit  = Gia_OrchHashAnd( p, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+        // the fanouts of the node are pending; its fanin edges are not
+        Vec_IntAddToEntry( p->vRefs, Abc_Lit2Var(iLit), Gia_ObjRefNumId(pGia, i) );
+        Gia_OrchRelease( p, Abc_Lit2Var(Gia_ObjFanin0Copy(pObj)) );
+        Gia_OrchRelease( p, Abc_Lit2Var(Gia_ObjFanin1Copy(pObj)) );
+        if ( Abc_Lit2Var(iLit) >= nObjs && Gia_OrchRefNum(p, Abc_Lit2Var(iLit)) > 0 )
+            iLit = Abc_LitNotCond( Gia_OrchNode(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+        else if ( !Gia_OrchIsAlive(p, Abc_Lit2Var(iLit)) )
+            Gia_OrchDeref_rec( p, Abc_Lit2Var(iLit) );
+        pObj->Value = iLit;
+    }
+    Gia_ManForEachCo( pGia, pObj, i )
+        pObj->Value = Gia_ManAppendCo( p->pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManHashStop( p->pNew );
+    Gia_ManSetRegNum( p->pNew, Gia_ManRegNum(pGia) );
+    pNew = Gia_ManCleanup( pTemp = p->pNew );
+    if ( fVerbose )
+    {
+        printf( "Nodes = %d -> %d.  Created = %d.  ", Gia_ManAndNum(pInit), Gia_ManAndNum(pNew), Gia_ManAndNum(pTemp) );
+        Abc_PrintTime( 1, "Total time", Abc_Clock() - clkTotal );
+        for ( k = 0; k < 3; k++ )
+        {
+            printf( "%s : Tried = %8d.  Changed = %7d.  Gain = %7d.  ", pNames[k], p->nTried[k], p->nChanges[k], p->nGains[k] );
+            Abc_PrintTime( 1, "Time", p->clkOps[k] );
+        }
+    }
+    Gia_OrchManStop( p );
+    Gia_ManStop( pGia );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
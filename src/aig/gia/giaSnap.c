@@ -0,0 +1,536 @@
+/**CFile****************************************************************
+
+  FileName    [giaSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Binary snapshot of the AIG with its attributes.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaSnap.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/tim/tim.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the snapshot of the AIG is the object array followed by the attribute records
+// each record starts with its tag; the records are terminated by GIA_SNAP_END
+typedef enum {
+    GIA_SNAP_END = 0,        // 0: the end of the records
+    GIA_SNAP_INT,            // 1: integer array (followed by the field number)
+    GIA_SNAP_FLT,            // 2: float array (followed by the field number)
+    GIA_SNAP_NAMES,          // 3: names (followed by the field number)
+    GIA_SNAP_MUXES,          // 4: control signals of MUXes
+    GIA_SNAP_REPRS,          // 5: representatives
+    GIA_SNAP_NEXTS,          // 6: next nodes in the equivalence classes
+    GIA_SNAP_SIBLS,          // 7: next nodes in the choice nodes
+    GIA_SNAP_PLACE,          // 8: placement
+    GIA_SNAP_SWITCH,         // 9: switching activity
+    GIA_SNAP_CELLSTR,        // 10: cell description
+    GIA_SNAP_TIME,           // 11: the timing manager
+    GIA_SNAP_EXTRA,          // 12: the logic of the holes
+    GIA_SNAP_DELAYS          // 13: delay parameters
+} Gia_SnapTag_t;
+
+// integer arrays of the manager saved in the snapshot
+static inline Vec_Int_t ** Gia_ManSnapIntField( Gia_Man_t * p, int iField )
+{
+    switch ( iField )
+    {
+    case  0: return &p->vMapping;
+    case  1: return &p->vCellMapping;
+    case  2: return &p->vPacking;
+    case  3: return &p->vConfigs;
+    case  4: return &p->vLutConfigs;
+    case  5: return &p->vEdgeDelay;
+    case  6: return &p->vEdgeDelayR;
+    case  7: return &p->vEdge1;
+    case  8: return &p->vEdge2;
+    case  9: return &p->vFlopClasses;
+    case 10: return &p->vGateClasses;
+    case 11: return &p->vObjClasses;
+    case 12: return &p->vInitClasses;
+    case 13: return &p->vRegClasses;
+    case 14: return &p->vRegInits;
+    case 15: return &p->vBarBufs;
+    case 16: return &p->vCiArrs;
+    case 17: return &p->vCoReqs;
+    case 18: return &p->vCoArrs;
+    case 19: return &p->vCoAttrs;
+    case 20: return &p->vWeights;
+    case 21: return &p->vSwitching;
+    case 22: return &p->vUserPiIds;
+    case 23: return &p->vUserPoIds;
+    case 24: return &p->vUserFfIds;
+    case 25: return &p->vCiNumsOrig;
+    case 26: return &p->vCoNumsOrig;
+    case 27: return &p->vIdsOrig;
+    case 28: return &p->vIdsEquiv;
+    case 29: return &p->vCofVars;
+    }
+    return NULL;
+}
+static inline Vec_Flt_t ** Gia_ManSnapFltField( Gia_Man_t * p, int iField )
+{
+    switch ( iField )
+    {
+    case  0: return &p->vInArrs;
+    case  1: return &p->vOutReqs;
+    case  2: return &p->vTiming;
+    }
+    return NULL;
+}
+static inline Vec_Ptr_t ** Gia_ManSnapNameField( Gia_Man_t * p, int iField )
+{
+    switch ( iField )
+    {
+    case  0: return &p->vNamesIn;
+    case  1: return &p->vNamesOut;
+    case  2: return &p->vNamesNode;
+    }
+    return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writing and reading primitives.]
+
+  Description [Numbers and arrays are saved in the native byte order,
+  so that the arrays can be copied from the memory-mapped file as they are.
+  The readers do not go beyond the end of the snapshot. If the data is not
+  available, they set the position to NULL and return 0 or empty arrays;
+  the following reads then fail as well.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_SnapPutInt( FILE * pFile, int Num )
+{
+    fwrite( &Num, sizeof(int), 1, pFile );
+}
+static inline void Gia_SnapPutArray( FILE * pFile, void * pArray, int nItems, int nItemSize )
+{
+    Gia_SnapPutInt( pFile, nItems );
+    if ( nItems > 0 )
+        fwrite( pArray, (size_t)nItemSize, (size_t)nItems, pFile );
+}
+static inline void Gia_SnapPutStr( FILE * pFile, char * pStr )
+{
+    Gia_SnapPutArray( pFile, pStr, pStr ? (int)strlen(pStr) + 1 : 0, 1 );
+}
+static inline int Gia_SnapGetInt( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    int Num;
+    if ( *ppPos == NULL || pEnd - *ppPos < (int)sizeof(int) )
+    {
+        *ppPos = NULL;
+        return 0;
+    }
+    memcpy( &Num, *ppPos, sizeof(int) );
+    *ppPos += sizeof(int);
+    return Num;
+}
+static inline void * Gia_SnapGetArray( unsigned char ** ppPos, unsigned char * pEnd, int nItemSize, int * pnItems )
+{
+    int nItems = Gia_SnapGetInt( ppPos, pEnd );
+    void * pArray;
+    if ( *ppPos == NULL || nItems < 0 || nItems > (pEnd - *ppPos) / nItemSize )
+    {
+        *ppPos = NULL;
+        nItems = 0;
+    }
+    pArray = ABC_ALLOC( char, Abc_MaxInt(1, nItems * nItemSize) );
+    if ( nItems > 0 )
+        memcpy( pArray, *ppPos, (size_t)nItems * nItemSize );
+    if ( *ppPos )
+        *ppPos += (size_t)nItems * nItemSize;
+    if ( pnItems )
+        *pnItems = nItems;
+    return pArray;
+}
+static inline void * Gia_SnapGetObjArray( unsigned char ** ppPos, unsigned char * pEnd, int nItemSize, int nObjs )
+{
+    int nItems;
+    void * pArray = Gia_SnapGetArray( ppPos, pEnd, nItemSize, &nItems );
+    if ( nItems != nObjs )
+        *ppPos = NULL;
+    return pArray;
+}
+static inline Vec_Int_t * Gia_SnapGetVecInt( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    int nItems;
+    int * pArray = (int *)Gia_SnapGetArray( ppPos, pEnd, sizeof(int), &nItems );
+    return Vec_IntAllocArray( pArray, nItems );
+}
+static inline Vec_Flt_t * Gia_SnapGetVecFlt( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    int nItems;
+    float * pArray = (float *)Gia_SnapGetArray( ppPos, pEnd, sizeof(float), &nItems );
+    return Vec_FltAllocArray( pArray, nItems );
+}
+static inline Vec_Str_t * Gia_SnapGetVecStr( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    int nItems;
+    char * pArray = (char *)Gia_SnapGetArray( ppPos, pEnd, 1, &nItems );
+    return Vec_StrAllocArray( pArray, nItems );
+}
+static inline char * Gia_SnapGetStr( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    int nItems;
+    char * pStr = (char *)Gia_SnapGetArray( ppPos, pEnd, 1, &nItems );
+    if ( nItems > 0 && pStr[nItems-1] == 0 )
+        return pStr;
+    if ( nItems > 0 )
+        *ppPos = NULL;
+    ABC_FREE( pStr );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the snapshot of the AIG into the file.]
+
+  Description [Saves the object array, the CIs/COs, and the attributes
+  of the AIG (mapping, packing, equivalences, choices, timing, names, etc).
+  Temporary data (hash table, fanouts, simulation info) is not saved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSnapWrite( Gia_Man_t * p, FILE * pFile )
+{
+    Vec_Int_t ** pvInt;
+    Vec_Flt_t ** pvFlt;
+    Vec_Ptr_t ** pvNames;
+    char * pName;
+    int i, k;
+    // write the parameters
+    Gia_SnapPutInt( pFile, Gia_ManObjNum(p) );
+    Gia_SnapPutInt( pFile, p->nRegs );
+    Gia_SnapPutInt( pFile, p->nConstrs );
+    Gia_SnapPutInt( pFile, p->nBufs );
+    Gia_SnapPutInt( pFile, p->nXors );
+    Gia_SnapPutInt( pFile, p->nMuxes );
+    Gia_SnapPutInt( pFile, p->fGiaSimple );
+    Gia_SnapPutStr( pFile, p->pName );
+    Gia_SnapPutStr( pFile, p->pSpec );
+    // write the objects
+    Gia_SnapPutArray( pFile, p->pObjs, Gia_ManObjNum(p), sizeof(Gia_Obj_t) );
+    Gia_SnapPutArray( pFile, Vec_IntArray(p->vCis), Vec_IntSize(p->vCis), sizeof(int) );
+    Gia_SnapPutArray( pFile, Vec_IntArray(p->vCos), Vec_IntSize(p->vCos), sizeof(int) );
+    // write the attributes
+    for ( i = 0; (pvInt = Gia_ManSnapIntField(p, i)); i++ )
+    {
+        if ( *pvInt == NULL )
+            continue;
+        Gia_SnapPutInt( pFile, GIA_SNAP_INT );
+        Gia_SnapPutInt( pFile, i );
+        Gia_SnapPutArray( pFile, Vec_IntArray(*pvInt), Vec_IntSize(*pvInt), sizeof(int) );
+    }
+    for ( i = 0; (pvFlt = Gia_ManSnapFltField(p, i)); i++ )
+    {
+        if ( *pvFlt == NULL )
+            continue;
+        Gia_SnapPutInt( pFile, GIA_SNAP_FLT );
+        Gia_SnapPutInt( pFile, i );
+        Gia_SnapPutArray( pFile, Vec_FltArray(*pvFlt), Vec_FltSize(*pvFlt), sizeof(float) );
+    }
+    for ( i = 0; (pvNames = Gia_ManSnapNameField(p, i)); i++ )
+    {
+        if ( *pvNames == NULL )
+            continue;
+        Gia_SnapPutInt( pFile, GIA_SNAP_NAMES );
+        Gia_SnapPutInt( pFile, i );
+        Gia_SnapPutInt( pFile, Vec_PtrSize(*pvNames) );
+        Vec_PtrForEachEntry( char *, *pvNames, pName, k )
+            Gia_SnapPutStr( pFile, pName );
+    }
+    if ( p->pMuxes )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_MUXES );
+        Gia_SnapPutArray( pFile, p->pMuxes, Gia_ManObjNum(p), sizeof(unsigned) );
+    }
+    if ( p->pReprs )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_REPRS );
+        Gia_SnapPutArray( pFile, p->pReprs, Gia_ManObjNum(p), sizeof(Gia_Rpr_t) );
+    }
+    if ( p->pNexts )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_NEXTS );
+        Gia_SnapPutArray( pFile, p->pNexts, Gia_ManObjNum(p), sizeof(int) );
+    }
+    if ( p->pSibls )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_SIBLS );
+        Gia_SnapPutArray( pFile, p->pSibls, Gia_ManObjNum(p), sizeof(int) );
+    }
+    if ( p->pPlacement )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_PLACE );
+        Gia_SnapPutArray( pFile, p->pPlacement, Gia_ManObjNum(p), sizeof(Gia_Plc_t) );
+    }
+    if ( p->pSwitching )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_SWITCH );
+        Gia_SnapPutArray( pFile, p->pSwitching, Gia_ManObjNum(p), sizeof(unsigned char) );
+    }
+    if ( p->pCellStr )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_CELLSTR );
+        Gia_SnapPutStr( pFile, p->pCellStr );
+    }
+    if ( p->pManTime )
+    {
+        Vec_Str_t * vStr = Tim_ManSave( (Tim_Man_t *)p->pManTime, 0 );
+        Gia_SnapPutInt( pFile, GIA_SNAP_TIME );
+        Gia_SnapPutArray( pFile, Vec_StrArray(vStr), Vec_StrSize(vStr), 1 );
+        Vec_StrFree( vStr );
+    }
+    if ( p->pAigExtra )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_EXTRA );
+        Gia_ManSnapWrite( p->pAigExtra, pFile );
+    }
+    if ( p->And2Delay || p->nAnd2Delay || p->DefInArrs != 0 || p->DefOutReqs != 0 )
+    {
+        Gia_SnapPutInt( pFile, GIA_SNAP_DELAYS );
+        Gia_SnapPutInt( pFile, p->And2Delay );
+        Gia_SnapPutInt( pFile, p->nAnd2Delay );
+        fwrite( &p->DefInArrs, sizeof(float), 1, pFile );
+        fwrite( &p->DefOutReqs, sizeof(float), 1, pFile );
+    }
+    Gia_SnapPutInt( pFile, GIA_SNAP_END );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the structure of the AIG loaded from the snapshot.]
+
+  Description [Makes sure that the fanins precede the objects, the CIs/COs
+  agree with their arrays, and the object arrays and the LUT mapping
+  refer to the objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ManSnapCheck( Gia_Man_t * p )
+{
+    Gia_Obj_t * pObj;
+    int i, k, iOffset, nCis = 0, nCos = 0, nObjs = Gia_ManObjNum(p);
+    if ( !Gia_ObjIsConst0(Gia_ManConst0(p)) || Gia_ManConst0(p)->fTerm )
+        return 0;
+    Gia_ManForEachObj1( p, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) )
+        {
+            if ( (int)pObj->iDiff1 >= Vec_IntSize(p->vCis) || Vec_IntEntry(p->vCis, pObj->iDiff1) != i )
+                return 0;
+            nCis++;
+        }
+        else if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( pObj->iDiff0 == 0 || (int)pObj->iDiff0 > i )
+                return 0;
+            if ( (int)pObj->iDiff1 >= Vec_IntSize(p->vCos) || Vec_IntEntry(p->vCos, pObj->iDiff1) != i )
+                return 0;
+            nCos++;
+        }
+        else if ( Gia_ObjIsAnd(pObj) )
+        {
+            if ( pObj->iDiff0 == 0 || (int)pObj->iDiff0 > i || pObj->iDiff1 == 0 || (int)pObj->iDiff1 > i )
+                return 0;
+            if ( p->pMuxes && Abc_Lit2Var(p->pMuxes[i]) >= i )
+                return 0;
+        }
+        else // the constant is the first object only
+            return 0;
+        if ( p->pReprs && p->pReprs[i].iRepr != GIA_VOID && (int)p->pReprs[i].iRepr >= nObjs )
+            return 0;
+        if ( p->pNexts && (p->pNexts[i] < 0 || p->pNexts[i] >= nObjs) )
+            return 0;
+        if ( p->pSibls && (p->pSibls[i] < 0 || p->pSibls[i] >= nObjs) )
+            return 0;
+    }
+    if ( nCis != Vec_IntSize(p->vCis) || nCos != Vec_IntSize(p->vCos) )
+        return 0;
+    if ( p->nRegs < 0 || p->nRegs > nCis || p->nRegs > nCos )
+        return 0;
+    // the LUT of the object is its size, the fanins, and the object
+    if ( p->vMapping == NULL )
+        return 1;
+    if ( Vec_IntSize(p->vMapping) < nObjs )
+        return 0;
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        iOffset = Vec_IntEntry( p->vMapping, i );
+        if ( iOffset == 0 )
+            continue;
+        if ( iOffset < nObjs || iOffset >= Vec_IntSize(p->vMapping) )
+            return 0;
+        if ( Gia_ObjLutSize(p, i) < 0 || iOffset + Gia_ObjLutSize(p, i) + 2 > Vec_IntSize(p->vMapping) )
+            return 0;
+        for ( k = 0; k <= Gia_ObjLutSize(p, i); k++ )
+            if ( Gia_ObjLutFanins(p, i)[k] < 0 || Gia_ObjLutFanins(p, i)[k] >= nObjs )
+                return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the snapshot of the AIG from memory.]
+
+  Description [Returns NULL and leaves the position unchanged if the
+  snapshot is truncated or corrupted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManSnapRead( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    Gia_Man_t * p;
+    Gia_Obj_t * pObj;
+    Vec_Int_t ** pvInt;
+    Vec_Flt_t ** pvFlt;
+    Vec_Ptr_t ** pvNames;
+    unsigned char * pCur = *ppPos;
+    int nObjs, nItems, Tag = -1, i;
+    // read the parameters
+    nObjs = Gia_SnapGetInt( &pCur, pEnd );
+    if ( pCur == NULL || nObjs <= 0 || nObjs > (pEnd - pCur) / (int)sizeof(Gia_Obj_t) )
+        return NULL;
+    p = Gia_ManStart( nObjs );
+    p->nRegs      = Gia_SnapGetInt( &pCur, pEnd );
+    p->nConstrs   = Gia_SnapGetInt( &pCur, pEnd );
+    p->nBufs      = Gia_SnapGetInt( &pCur, pEnd );
+    p->nXors      = Gia_SnapGetInt( &pCur, pEnd );
+    p->nMuxes     = Gia_SnapGetInt( &pCur, pEnd );
+    p->fGiaSimple = Gia_SnapGetInt( &pCur, pEnd );
+    p->pName      = Gia_SnapGetStr( &pCur, pEnd );
+    p->pSpec      = Gia_SnapGetStr( &pCur, pEnd );
+    // read the objects
+    nItems = Gia_SnapGetInt( &pCur, pEnd );
+    if ( pCur == NULL || nItems != nObjs || nObjs > (pEnd - pCur) / (int)sizeof(Gia_Obj_t) )
+    {
+        Gia_ManStop( p );
+        return NULL;
+    }
+    memcpy( p->pObjs, pCur, (size_t)nObjs * sizeof(Gia_Obj_t) );
+    pCur += (size_t)nObjs * sizeof(Gia_Obj_t);
+    p->nObjs = nObjs;
+    Gia_ManForEachObj( p, pObj, i )
+        pObj->fMark0 = pObj->fMark1 = 0;
+    Vec_IntFree( p->vCis );
+    Vec_IntFree( p->vCos );
+    p->vCis = Gia_SnapGetVecInt( &pCur, pEnd );
+    p->vCos = Gia_SnapGetVecInt( &pCur, pEnd );
+    // read the attributes
+    while ( (Tag = Gia_SnapGetInt(&pCur, pEnd)) != GIA_SNAP_END )
+    {
+        if ( Tag == GIA_SNAP_INT && (pvInt = Gia_ManSnapIntField(p, Gia_SnapGetInt(&pCur, pEnd))) )
+        {
+            Vec_IntFreeP( pvInt );
+            *pvInt = Gia_SnapGetVecInt( &pCur, pEnd );
+        }
+        else if ( Tag == GIA_SNAP_FLT && (pvFlt = Gia_ManSnapFltField(p, Gia_SnapGetInt(&pCur, pEnd))) )
+        {
+            Vec_FltFreeP( pvFlt );
+            *pvFlt = Gia_SnapGetVecFlt( &pCur, pEnd );
+        }
+        else if ( Tag == GIA_SNAP_NAMES && (pvNames = Gia_ManSnapNameField(p, Gia_SnapGetInt(&pCur, pEnd))) )
+        {
+            // each name takes at least one number (its size)
+            nItems = Gia_SnapGetInt( &pCur, pEnd );
+            if ( pCur == NULL || nItems < 0 || nItems > (pEnd - pCur) / (int)sizeof(int) )
+                break;
+            Vec_PtrFreeFree( *pvNames );
+            *pvNames = Vec_PtrAlloc( nItems );
+            for ( i = 0; i < nItems; i++ )
+                Vec_PtrPush( *pvNames, Gia_SnapGetStr(&pCur, pEnd) );
+        }
+        else if ( Tag == GIA_SNAP_MUXES )
+        {
+            ABC_FREE( p->pMuxes );
+            p->pMuxes = (unsigned *)Gia_SnapGetObjArray( &pCur, pEnd, sizeof(unsigned), nObjs );
+        }
+        else if ( Tag == GIA_SNAP_REPRS && p->pReprs == NULL )
+            p->pReprs = (Gia_Rpr_t *)Gia_SnapGetObjArray( &pCur, pEnd, sizeof(Gia_Rpr_t), nObjs );
+        else if ( Tag == GIA_SNAP_NEXTS && p->pNexts == NULL )
+            p->pNexts = (int *)Gia_SnapGetObjArray( &pCur, pEnd, sizeof(int), nObjs );
+        else if ( Tag == GIA_SNAP_SIBLS && p->pSibls == NULL )
+            p->pSibls = (int *)Gia_SnapGetObjArray( &pCur, pEnd, sizeof(int), nObjs );
+        else if ( Tag == GIA_SNAP_PLACE && p->pPlacement == NULL )
+            p->pPlacement = (Gia_Plc_t *)Gia_SnapGetObjArray( &pCur, pEnd, sizeof(Gia_Plc_t), nObjs );
+        else if ( Tag == GIA_SNAP_SWITCH && p->pSwitching == NULL )
+            p->pSwitching = (unsigned char *)Gia_SnapGetObjArray( &pCur, pEnd, sizeof(unsigned char), nObjs );
+        else if ( Tag == GIA_SNAP_CELLSTR && p->pCellStr == NULL )
+            p->pCellStr = Gia_SnapGetStr( &pCur, pEnd );
+        else if ( Tag == GIA_SNAP_TIME && p->pManTime == NULL )
+        {
+            Vec_Str_t * vStr = Gia_SnapGetVecStr( &pCur, pEnd );
+            if ( pCur != NULL )
+                p->pManTime = Tim_ManLoad( vStr, 0 );
+            Vec_StrFree( vStr );
+        }
+        else if ( Tag == GIA_SNAP_EXTRA && p->pAigExtra == NULL )
+        {
+            p->pAigExtra = Gia_ManSnapRead( &pCur, pEnd );
+            if ( p->pAigExtra == NULL )
+                break;
+        }
+        else if ( Tag == GIA_SNAP_DELAYS )
+        {
+            p->And2Delay  = Gia_SnapGetInt( &pCur, pEnd );
+            p->nAnd2Delay = Gia_SnapGetInt( &pCur, pEnd );
+            if ( pCur == NULL || pEnd - pCur < 2 * (int)sizeof(float) )
+                break;
+            memcpy( &p->DefInArrs, pCur, sizeof(float) );   pCur += sizeof(float);
+            memcpy( &p->DefOutReqs, pCur, sizeof(float) );  pCur += sizeof(float);
+        }
+        else
+            break;
+    }
+    if ( pCur == NULL || Tag != GIA_SNAP_END || !Gia_ManSnapCheck(p) )
+    {
+        Gia_ManStop( p );
+        return NULL;
+    }
+    *ppPos = pCur;
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
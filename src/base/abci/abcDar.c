@@ -2576,6 +2576,8 @@ int Abc_NtkDarBmcInter_int( Aig_Man_t * pMan, Inter_ManParams_t * pPars, Aig_Man
                     pTemp->pSeqModel = Abc_CexCreate( Aig_ManRegNum(pMan), Saig_ManPiNum(pMan), (int *)pTemp->pData, 0, i, 1 );
 //                pNtk->pModel = pTemp->pData, pTemp->pData = NULL;
             }
+            else if ( pPars->nProcs > 1 )
+                RetValue = Inter_ManPerformInterpolationPar( pTemp, pPars, &iFrame );
             else
                 RetValue = Inter_ManPerformInterpolation( pTemp, pPars, &iFrame );
             if ( pTemp->pSeqModel )
@@ -2628,7 +2630,10 @@ int Abc_NtkDarBmcInter_int( Aig_Man_t * pMan, Inter_ManParams_t * pPars, Aig_Man
     }
     else
     {    
-        RetValue = Inter_ManPerformInterpolation( pMan, pPars, &iFrame );
+        if ( pPars->nProcs > 1 )
+            RetValue = Inter_ManPerformInterpolationPar( pMan, pPars, &iFrame );
+        else
+            RetValue = Inter_ManPerformInterpolation( pMan, pPars, &iFrame );
     }
     if ( nTotalProvedSat )
         Abc_Print( 1, "The total of %d outputs proved SAT and replaced by const 0 in this run.\n", nTotalProvedSat );
@@ -3081,6 +3086,13 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
         Abc_Print( 1, "Converting network into AIG has failed.\n" );
         return -1;
     }
+    if ( (pPars->pPoolRead || pPars->pPoolWrite) && pPars->vFlopNames == NULL )
+    {
+        Abc_Obj_t * pLatch; int i;
+        pPars->vFlopNames = Vec_PtrAlloc( Abc_NtkLatchNum(pNtk) );
+        Abc_NtkForEachLatch( pNtk, pLatch, i )
+            Vec_PtrPush( pPars->vFlopNames, Abc_ObjName(Abc_ObjFanout0(pLatch)) );
+    }
     RetValue = Pdr_ManSolve( pMan, pPars );
     pPars->nDropOuts = Saig_ManPoNum(pMan) - pPars->nProveOuts - pPars->nFailOuts;
     if ( !pPars->fSilent )
@@ -3133,6 +3145,7 @@ int Abc_NtkDarPdr( Abc_Ntk_t * pNtk, Pdr_Par_t * pPars )
         Vec_PtrFreeFree( pNtk->vSeqModelVec );
     pNtk->vSeqModelVec = pMan->vSeqModelVec;
     pMan->vSeqModelVec = NULL;
+    Vec_PtrFreeP( &pPars->vFlopNames );
     Aig_ManStop( pMan );
     return RetValue;
 }
@@ -3658,7 +3671,11 @@ int Abc_NtkDarSeqSim3( Abc_Ntk_t * pNtk, Ssw_RarPars_t * pPars )
         Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
     }
     pMan = Abc_NtkToDar( pNtk, 0, 1 );
-    if ( Ssw_RarSimulate( pMan, pPars ) == 0 )
+    if ( pPars->nProcs > 1 )
+        status = Ssw_RarSimulatePar( pMan, pPars );
+    else
+        status = Ssw_RarSimulate( pMan, pPars );
+    if ( status == 0 )
     { 
         if ( pMan->pSeqModel )
         {
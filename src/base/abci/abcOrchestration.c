@@ -24,6 +24,7 @@
 #include "bool/dec/dec.h"
 #include "opt/rwr/rwr.h"
 #include "bool/kit/kit.h"
+#include "misc/vec/vecQue.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -43,6 +44,7 @@ extern int         Dec_GraphUpdateNetwork( Abc_Obj_t * pRoot, Dec_Graph_t * pGra
 
 #define ABC_RS_DIV1_MAX    150   // the max number of divisors to consider
 #define ABC_RS_DIV2_MAX    500   // the max number of pair-wise divisors to consider
+#define ABC_ORCH_TFO_DEPTH   2   // the fanout levels requeued around a change by incremental orchestration
 
 typedef struct Abc_ManRes_t_ Abc_ManRes_t;
 struct Abc_ManRes_t_
@@ -3489,6 +3491,359 @@ s_ResubTime = Abc_Clock() - clkStart;
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Helpers of the worklist-driven orchestration.]
+
+  Description [The rewriting cuts of a node are computed from the cuts of
+  its fanins, so a node without cuts has no fanouts with cuts. When the
+  node is replaced, the cuts of its TFO become stale and are freed by 
+  visiting the fanouts that have cuts. The nodes around the change are 
+  queued for the next pass, unless they are still waiting in this one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkOrchFreeCutsTfo_rec( Cut_Man_t * pManCut, Abc_Obj_t * pObj )
+{
+    Abc_Obj_t * pFanout;
+    int i;
+    if ( Abc_NodeReadCuts(pManCut, pObj) == NULL )
+        return;
+    Abc_NodeFreeCuts( pManCut, pObj );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+        if ( Abc_ObjIsNode(pFanout) )
+            Abc_NtkOrchFreeCutsTfo_rec( pManCut, pFanout );
+}
+void Abc_NtkOrchRequeueTfo_rec( Abc_Obj_t * pObj, int nDepth, Vec_Que_t * pQue, Vec_Int_t * vNext, Vec_Int_t * vMarks )
+{
+    Abc_Obj_t * pFanout;
+    int i;
+    if ( Abc_ObjIsNode(pObj) && !Vec_QueIsMember(pQue, Abc_ObjId(pObj)) && !Vec_IntEntry(vMarks, Abc_ObjId(pObj)) )
+    {
+        Vec_IntWriteEntry( vMarks, Abc_ObjId(pObj), 1 );
+        Vec_IntPush( vNext, Abc_ObjId(pObj) );
+    }
+    if ( nDepth == 0 )
+        return;
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+        if ( Abc_ObjIsNode(pFanout) )
+            Abc_NtkOrchRequeueTfo_rec( pFanout, nDepth - 1, pQue, vNext, vMarks );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worklist-driven orchestration.]
+
+  Description [Performs up to nIters passes of local greedy orchestration.
+  The first pass evaluates every node. The following passes only evaluate
+  the nodes near the changes of the previous pass: the new nodes, the cut
+  leaves and the fanouts of the replaced node, and their fanouts up to
+  ABC_ORCH_TFO_DEPTH levels. This is a heuristic: a change may also alter
+  the gains of the nodes outside of this window, for example by changing
+  their MFFC sizes or their reverse levels, and these nodes are not 
+  revisited. Because the nodes are evaluated when they are dequeued, no 
+  gains are stored. Within a pass, the nodes are visited in the order of 
+  their levels, using a priority queue.
+  The reverse levels are computed once and, as well as the levels, are 
+  updated incrementally by the replacements. The rewriting cuts are 
+  restarted between the passes, and the network is normalized once at 
+  the end.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchIncremental( Abc_Ntk_t * pNtk, int nIters, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+{
+    // For resub
+    Abc_ManRes_t * pManRes;
+    Abc_ManCut_t * pManCutRes;
+    Odc_Man_t * pManOdc = NULL;
+    Dec_Graph_t * pFFormRes;
+    Vec_Ptr_t * vLeaves;
+    // For rewrite
+    Cut_Man_t * pManCutRwr;
+    Rwr_Man_t * pManRwr;
+    Dec_Graph_t * pGraph;
+    // For refactor
+    Abc_ManRef_t * pManRef;
+    Abc_ManCut_t * pManCutRef;
+    Dec_Graph_t * pFFormRef;
+    Vec_Ptr_t * vFanins;
+    // For the worklist
+    Vec_Ptr_t * vCut;
+    Vec_Que_t * pQue;
+    Vec_Flt_t * vPrios;
+    Vec_Int_t * vNext, * vMarks, * vSeeds;
+
+    Abc_Obj_t * pNode, * pObj;
+    abctime clk, clkIter, clkStart = Abc_Clock();
+    int i, k, Iter, iNode, nObjsOld, nGain, nGainBest, GainRes, GainRef, fCompl, RetValue = 1;
+    int nEvals, ops_rwr, ops_res, ops_ref;
+    assert( Abc_NtkIsStrash(pNtk) );
+    assert( nIters >= 1 );
+
+    // cleanup the AIG
+    Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
+
+    // start the managers resub
+    pManCutRes = Abc_NtkManCutStart( nCutMax, 100000, 100000, 100000 );
+    pManRes = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
+    if ( nLevelsOdc > 0 )
+    pManOdc = Abc_NtkDontCareAlloc( nCutMax, nLevelsOdc, fVerbose, fVeryVerbose );
+    // start the managers refactor
+    pManCutRef = Abc_NtkManCutStart( nNodeSizeMax, nConeSizeMax, 2, 1000 );
+    pManRef = Abc_NtkManRefStart_1( nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose );
+    pManRef->vLeaves   = Abc_NtkManCutReadCutLarge( pManCutRef );
+    // start the managers rewrite
+    pManRwr = Rwr_ManStart( 0 );
+    if ( pManRwr == NULL )
+        return 0;
+
+    // compute the reverse levels if level update is requested
+    if ( fUpdateLevel )
+        Abc_NtkStartReverseLevels( pNtk, 0 );
+
+    // 'Resub only'
+    if ( Abc_NtkLatchNum(pNtk) ) {
+        Abc_NtkForEachLatch(pNtk, pNode, i)
+            pNode->pNext = (Abc_Obj_t *)pNode->pData;
+    }
+    // cut manager for rewrite
+clk = Abc_Clock();
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
+    pNtk->pManCut = pManCutRwr;
+
+    if ( fVeryVerbose )
+        Rwr_ScoresClean( pManRwr );
+
+    pManRes->nNodesBeg = Abc_NtkNodeNum(pNtk);
+    pManRwr->nNodesBeg = Abc_NtkNodeNum(pNtk);
+    pManRef->nNodesBeg = Abc_NtkNodeNum(pNtk);
+
+    // the nodes with lower levels come first
+    vPrios = Vec_FltAlloc( 0 );
+    pQue   = Vec_QueAlloc( Abc_NtkObjNumMax(pNtk) );
+    Vec_QueSetPriority( pQue, Vec_FltArrayP(vPrios) );
+    vNext  = Vec_IntAlloc( Abc_NtkObjNumMax(pNtk) );
+    vMarks = Vec_IntAlloc( 0 );
+    vSeeds = Vec_IntAlloc( 100 );
+    Abc_NtkForEachNode( pNtk, pNode, i )
+        Vec_IntPush( vNext, i );
+
+    for ( Iter = 0; Iter < nIters && Vec_IntSize(vNext) > 0; Iter++ )
+    {
+        clkIter = Abc_Clock();
+        nEvals = ops_rwr = ops_res = ops_ref = 0;
+        // restart the cuts (the reverse levels are kept up to date by the replacements)
+        if ( Iter > 0 )
+        {
+            Cut_ManStop( pManCutRwr );
+clk = Abc_Clock();
+            pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
+            pNtk->pManCut = pManCutRwr;
+        }
+        // move the nodes of this pass into the queue
+        Vec_FltFillExtra( vPrios, Abc_NtkObjNumMax(pNtk), 0 );
+        Vec_IntFillExtra( vMarks, Abc_NtkObjNumMax(pNtk), 0 );
+        Vec_IntForEachEntry( vNext, iNode, i )
+        {
+            Vec_IntWriteEntry( vMarks, iNode, 0 );
+            pNode = Abc_NtkObj( pNtk, iNode );
+            if ( pNode == NULL || !Abc_ObjIsNode(pNode) || Vec_QueIsMember(pQue, iNode) )
+                continue;
+            Vec_FltWriteEntry( vPrios, iNode, -(float)Abc_ObjLevel(pNode) );
+            Vec_QuePush( pQue, iNode );
+        }
+        Vec_IntClear( vNext );
+        while ( Vec_QueSize(pQue) > 0 )
+        {
+            iNode = Vec_QuePop( pQue );
+            pNode = Abc_NtkObj( pNtk, iNode );
+            // skip the nodes removed by the previous updates
+            if ( pNode == NULL || !Abc_ObjIsNode(pNode) )
+                continue;
+            // skip persistant nodes and the nodes with many fanouts
+            if ( Abc_NodeIsPersistant(pNode) || Abc_ObjFanoutNum(pNode) > 1000 )
+                continue;
+            nEvals++;
+clk = Abc_Clock();
+//Refactor
+            vFanins = Abc_NodeFindCut( pManCutRef, pNode, fUseDcs );
+pManRef->timeCut += Abc_Clock() - clk;
+clk = Abc_Clock();
+            pFFormRef = Abc_NodeRefactor_1( pManRef, pNode, vFanins, fUpdateLevel, fUseZeros_ref, fUseDcs, fVerbose );
+            GainRef = pFFormRef ? pManRef->nLastGain : -1;
+pManRef->timeRes += Abc_Clock() - clk;
+// Resub
+clk = Abc_Clock();
+            vLeaves = Abc_NodeFindCut( pManCutRes, pNode, 0 );
+pManRes->timeCut += Abc_Clock() - clk;
+            if ( pManOdc )
+            {
+clk = Abc_Clock();
+                Abc_NtkDontCareClear( pManOdc );
+                Abc_NtkDontCareCompute( pManOdc, pNode, vLeaves, pManRes->pCareSet );
+pManRes->timeTruth += Abc_Clock() - clk;
+            }
+clk = Abc_Clock();
+            pFFormRes = Abc_ManResubEval( pManRes, pNode, vLeaves, nStepsMax, fUpdateLevel, fVerbose );
+            GainRes = pFFormRes ? pManRes->nLastGain : -1;
+pManRes->timeRes += Abc_Clock() - clk;
+// Rewrite
+            nGain = Rwr_NodeRewrite( pManRwr, pManCutRwr, pNode, fUpdateLevel, fUseZeros_rwr, fPlaceEnable );
+
+            // the seeds of the next pass are the leaves of the chosen cut and the fanouts of the node
+            if ( nGain >= 0 && nGain >= GainRes && nGain >= GainRef )
+                vCut = Rwr_ManReadLeaves( pManRwr ), nGainBest = nGain;
+            else if ( GainRes >= 0 && GainRes >= GainRef )
+                vCut = vLeaves, nGainBest = GainRes;
+            else if ( GainRef >= 0 )
+                vCut = vFanins, nGainBest = GainRef;
+            else
+                vCut = NULL, nGainBest = -1;
+            if ( vCut == NULL )
+            {
+                if ( pFFormRes ) Dec_GraphFree( pFFormRes );
+                if ( pFFormRef ) Dec_GraphFree( pFFormRef );
+                continue;
+            }
+            Vec_IntClear( vSeeds );
+            Vec_PtrForEachEntry( Abc_Obj_t *, vCut, pObj, k )
+                Vec_IntPush( vSeeds, Abc_ObjId(Abc_ObjRegular(pObj)) );
+            Abc_ObjForEachFanout( pNode, pObj, k )
+            {
+                Vec_IntPush( vSeeds, Abc_ObjId(pObj) );
+                if ( Abc_ObjIsNode(pObj) )
+                    Abc_NtkOrchFreeCutsTfo_rec( pManCutRwr, pObj );
+            }
+            nObjsOld = Abc_NtkObjNumMax( pNtk );
+
+            if ( vCut == Rwr_ManReadLeaves(pManRwr) )
+            {
+            // update with rewrite
+                if ( pFFormRes ) Dec_GraphFree( pFFormRes );
+                if ( pFFormRef ) Dec_GraphFree( pFFormRef );
+                pGraph = (Dec_Graph_t *)Rwr_ManReadDecs(pManRwr);
+                fCompl = Rwr_ManReadCompl(pManRwr);
+                if ( fPlaceEnable )
+                    Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
+                if ( fCompl ) Dec_GraphComplement( pGraph );
+clk = Abc_Clock();
+                Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
+                if ( fCompl ) Dec_GraphComplement( pGraph );
+                ops_rwr++;
+            }
+            else if ( vCut == vLeaves )
+            {
+            // update with resub
+                if ( pFFormRef ) Dec_GraphFree( pFFormRef );
+                pManRes->nTotalGain += pManRes->nLastGain;
+clk = Abc_Clock();
+                Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+pManRes->timeNtk += Abc_Clock() - clk;
+                Dec_GraphFree( pFFormRes );
+                ops_res++;
+            }
+            else
+            {
+            // update with refactor
+                if ( pFFormRes ) Dec_GraphFree( pFFormRes );
+clk = Abc_Clock();
+                if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+                {
+                    Dec_GraphFree( pFFormRef );
+                    RetValue = -1;
+                    break;
+                }
+pManRef->timeNtk += Abc_Clock() - clk;
+                Dec_GraphFree( pFFormRef );
+                ops_ref++;
+            }
+
+            // requeue the nodes around the change
+            if ( nGainBest == 0 )
+                Vec_IntClear( vSeeds );
+            for ( k = nObjsOld; k < Abc_NtkObjNumMax(pNtk); k++ )
+                Vec_IntPush( vSeeds, k );
+            Vec_IntFillExtra( vMarks, Abc_NtkObjNumMax(pNtk), 0 );
+            Vec_IntForEachEntry( vSeeds, iNode, k )
+                if ( (pObj = Abc_NtkObj(pNtk, iNode)) )
+                    Abc_NtkOrchRequeueTfo_rec( pObj, nGainBest ? ABC_ORCH_TFO_DEPTH : 0, pQue, vNext, vMarks );
+        }
+        if ( fVerbose )
+        {
+            printf( "Pass %2d : Evaluated = %8d.  Rw = %6d.  Rs = %6d.  Rf = %6d.  Nodes = %8d.  Queued = %8d.  ", 
+                Iter + 1, nEvals, ops_rwr, ops_res, ops_ref, Abc_NtkNodeNum(pNtk), Vec_IntSize(vNext) );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clkIter );
+        }
+        if ( RetValue == -1 )
+            break;
+    }
+    Vec_QueFree( pQue );
+    Vec_FltFree( vPrios );
+    Vec_IntFree( vNext );
+    Vec_IntFree( vMarks );
+    Vec_IntFree( vSeeds );
+
+Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
+    pManRwr->nNodesEnd = Abc_NtkNodeNum(pNtk);
+pManRes->timeTotal = Abc_Clock() - clkStart;
+    pManRes->nNodesEnd = Abc_NtkNodeNum(pNtk);
+pManRef->timeTotal = Abc_Clock() - clkStart;
+    pManRef->nNodesEnd = Abc_NtkNodeNum(pNtk);
+
+    // print statistics
+    if ( fVerbose ){
+        Abc_ManResubPrint( pManRes );
+        Rwr_ManPrintStats( pManRwr );
+        Abc_NtkManRefPrintStats_1( pManRef );
+    }
+    if ( fVeryVerbose )
+        Rwr_ScoresReport( pManRwr );
+    // delete the managers
+    Abc_ManResubStop( pManRes );
+    Abc_NtkManCutStop( pManCutRes );
+    Rwr_ManStop( pManRwr );
+    Cut_ManStop( pManCutRwr );
+    pNtk->pManCut = NULL;
+    Abc_NtkManCutStop( pManCutRef );
+    Abc_NtkManRefStop_1( pManRef );
+    if ( pManOdc ) Abc_NtkDontCareFree( pManOdc );
+
+    // clean the data field
+    Abc_NtkForEachObj( pNtk, pNode, i )
+        pNode->pData = NULL;
+
+    if ( Abc_NtkLatchNum(pNtk) ) {
+        Abc_NtkForEachLatch(pNtk, pNode, i)
+            pNode->pData = pNode->pNext, pNode->pNext = NULL;
+    }
+
+    // put the nodes into the DFS order and reassign their IDs
+    Abc_NtkReassignIds( pNtk );
+
+    // fix the levels
+    if ( fUpdateLevel )
+        Abc_NtkStopReverseLevels( pNtk );
+    else
+        Abc_NtkLevel( pNtk );
+    // check
+    if ( !Abc_NtkCheck( pNtk ) )
+    {
+        printf( "Abc_NtkOrchIncremental: The network check has failed.\n" );
+        return 0;
+    }
+    return RetValue;
+}
+
 // priority order orchestration (runtime improved TBD)
 int Abc_NtkOchestration( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_res,Vec_Int_t **pGain_ref, int sOpsOrder, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
 {
@@ -87,6 +87,7 @@ extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
+extern Abc_Ntk_t *        Io_ReadBlifMvPar( char * pFileName, int fBlifMv, int fCheck, int nProcs );
 /*=== abcReadBench.c ==========================================================*/
 extern Abc_Ntk_t *        Io_ReadBench( char * pFileName, int fCheck );
 extern void               Io_ReadBenchInit( Abc_Ntk_t * pNtk, char * pFileName );
@@ -142,7 +143,9 @@ extern void               Io_WriteVerilog( Abc_Ntk_t * pNtk, char * FileName, in
 extern Io_FileType_t      Io_ReadFileType( char * pFileName );
 extern Io_FileType_t      Io_ReadLibType( char * pFileName );
 extern Abc_Ntk_t *        Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck );
+extern Abc_Ntk_t *        Io_ReadNetlistPar( char * pFileName, Io_FileType_t FileType, int fCheck, int nProcs );
 extern Abc_Ntk_t *        Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs );
+extern Abc_Ntk_t *        Io_ReadPar( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs, int nProcs );
 extern void               Io_Write( Abc_Ntk_t * pNtk, char * pFileName, Io_FileType_t FileType );
 extern void               Io_WriteHie( Abc_Ntk_t * pNtk, char * pBaseName, char * pFileName );
 extern Abc_Obj_t *        Io_ReadCreatePi( Abc_Ntk_t * pNtk, char * pName );
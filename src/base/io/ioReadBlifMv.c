@@ -24,6 +24,17 @@
 #include "misc/vec/vecPtr.h"
 #include "ioAbc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -31,6 +42,8 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 #define IO_BLIFMV_MAXVALUES 256
+#define IO_BLIFMV_THR_MAX   100     // the max number of threads parsing the tables
+#define IO_BLIFMV_PAR_MIN  1000     // the min number of tables to parse them concurrently
 //#define IO_VERBOSE_OUTPUT
 
 typedef struct Io_MvVar_t_ Io_MvVar_t; // parsing var
@@ -87,6 +100,11 @@ struct Io_MvMan_t_
     Vec_Ptr_t *          vTokens;      // the current tokens
     Vec_Ptr_t *          vTokens2;     // the current tokens
     Vec_Str_t *          vFunc;        // the local function
+    // concurrent parsing of the tables
+    int                  nProcs;       // the number of threads
+    Vec_Ptr_t *          vLineEnds;    // the ends of the pre-split .names lines
+    Vec_Ptr_t *          vSops;        // the pre-parsed SOP covers of the .names lines
+    Vec_Ptr_t *          vArenas;      // the per-thread storage of the SOP covers
     // error reporting
     char                 sError[512];  // the error string generated during parsing
     // statistics 
@@ -113,7 +131,9 @@ static int               Io_MvParseLineSubckt( Io_MvMod_t * p, char * pLine );
 static Vec_Int_t *       Io_MvParseLineOnehot( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineMv( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineNamesMv( Io_MvMod_t * p, char * pLine, int fReset );
-static int               Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine );
+static int               Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine, char * pLineEnd, char * pSop );
+static void              Io_MvParseTablesBlifPar( Io_MvMod_t * p );
+static void              Io_MvStopTablesBlifPar( Io_MvMan_t * p );
 static int               Io_MvParseLineShortBlif( Io_MvMod_t * p, char * pLine );
 static int                 Io_MvParseLineLtlProperty( Io_MvMod_t * p, char * pLine );
 static int               Io_MvParseLineGateBlif( Io_MvMod_t * p, Vec_Ptr_t * vTokens );
@@ -132,14 +152,15 @@ extern void              Abc_NtkStartMvVars( Abc_Ntk_t * pNtk );
 
   Synopsis    [Reads the network from the BLIF or BLIF-MV file.]
 
-  Description []
+  Description [When nProcs > 1, the SOP tables of the BLIF file are
+  tokenized and parsed by nProcs threads before the network is linked.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
+Abc_Ntk_t * Io_ReadBlifMvPar( char * pFileName, int fBlifMv, int fCheck, int nProcs )
 {
     FILE * pFile;
     Io_MvMan_t * p;
@@ -162,6 +183,7 @@ Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
     p = Io_MvAlloc();
     p->fBlifMv   = fBlifMv;
     p->fUseReset = 1;
+    p->nProcs    = nProcs;
     p->pFileName = pFileName;
     p->pBuffer   = Io_MvLoadFile( pFileName );
     if ( p->pBuffer == NULL )
@@ -254,6 +276,10 @@ Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
     Vec_PtrFreeP( &vGlobalLtlArray );
     return pNtk;
 }
+Abc_Ntk_t * Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck )
+{
+    return Io_ReadBlifMvPar( pFileName, fBlifMv, fCheck, 1 );
+}
 
 /**Function*************************************************************
 
@@ -306,6 +332,7 @@ static void Io_MvFree( Io_MvMan_t * p )
             Io_MvModFree( pMod );
         Vec_PtrFree( p->vModels );
     }
+    Io_MvStopTablesBlifPar( p );
     Vec_PtrFree( p->vTokens );
     Vec_PtrFree( p->vTokens2 );
     Vec_StrFree( p->vFunc );
@@ -956,9 +983,15 @@ static Abc_Des_t * Io_MvParse( Io_MvMan_t * p )
         }
         else
         {
+            // pre-parse the tables concurrently (sets p->vLineEnds and p->vSops)
+            if ( p->nProcs > 1 && Vec_PtrSize(pMod->vNames) >= IO_BLIFMV_PAR_MIN )
+                Io_MvParseTablesBlifPar( pMod );
             Vec_PtrForEachEntry( char *, pMod->vNames, pLine, k )
-                if ( !Io_MvParseLineNamesBlif( pMod, pLine ) )
+                if ( !Io_MvParseLineNamesBlif( pMod, pLine, 
+                        p->vLineEnds ? (char *)Vec_PtrEntry(p->vLineEnds, k) : NULL, 
+                        p->vSops ? (char *)Vec_PtrEntry(p->vSops, k) : NULL ) )
                     return NULL;
+            Io_MvStopTablesBlifPar( p );
             Vec_PtrForEachEntry( char *, pMod->vShorts, pLine, k )
                 if ( !Io_MvParseLineShortBlif( pMod, pLine ) )
                     return NULL;
@@ -1997,58 +2030,65 @@ static int Io_MvParseLineNamesMv( Io_MvMod_t * p, char * pLine, int fReset )
   SeeAlso     []
 
 ***********************************************************************/
-static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+static int Io_MvParseTableBlifInt( Io_MvMan_t * p, Vec_Ptr_t * vTokens, Vec_Str_t * vFunc, char * pTable, int nFanins, char * pError )
 {
-    Vec_Ptr_t * vTokens = p->pMan->vTokens;
-    Vec_Str_t * vFunc = p->pMan->vFunc;
     char * pProduct, * pOutput, c;
     int i, Polarity = -1;
 
-    p->pMan->nTablesRead++;
     // get the tokens
     Io_MvSplitIntoTokens( vTokens, pTable, '.' );
     if ( Vec_PtrSize(vTokens) == 0 )
-        return Abc_SopCreateConst0( (Mem_Flex_t *)p->pNtk->pManFunc );
+    {
+        Vec_StrPrintStr( vFunc, " 0\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
+    }
     if ( Vec_PtrSize(vTokens) == 1 )
     {
         pOutput = (char *)Vec_PtrEntry( vTokens, 0 );
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(p->pMan, pOutput), pOutput );
-            return NULL;
+            if ( pError )
+                sprintf( pError, "Line %d: Constant table has wrong output value \"%s\".", Io_MvGetLine(p, pOutput), pOutput );
+            return 0;
         }
-        return pOutput[0] == '0' ? Abc_SopCreateConst0((Mem_Flex_t *)p->pNtk->pManFunc) : Abc_SopCreateConst1((Mem_Flex_t *)p->pNtk->pManFunc);
+        Vec_StrPrintStr( vFunc, pOutput[0] == '0' ? " 0\n" : " 1\n" );
+        Vec_StrPush( vFunc, '\0' );
+        return 1;
     }
     pProduct = (char *)Vec_PtrEntry( vTokens, 0 );
     if ( Vec_PtrSize(vTokens) % 2 == 1 )
     {
-        sprintf( p->pMan->sError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(p->pMan, pProduct), Vec_PtrSize(vTokens) );
-        return NULL;
+        if ( pError )
+            sprintf( pError, "Line %d: Table has odd number of tokens (%d).", Io_MvGetLine(p, pProduct), Vec_PtrSize(vTokens) );
+        return 0;
     }
     // parse the table
-    Vec_StrClear( vFunc );
     for ( i = 0; i < Vec_PtrSize(vTokens)/2; i++ )
     {
         pProduct = (char *)Vec_PtrEntry( vTokens, 2*i + 0 );
         pOutput  = (char *)Vec_PtrEntry( vTokens, 2*i + 1 );
         if ( strlen(pProduct) != (unsigned)nFanins )
         {
-            sprintf( p->pMan->sError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(p->pMan, pProduct), pProduct, nFanins );
-            return NULL;
+            if ( pError )
+                sprintf( pError, "Line %d: Cube \"%s\" has size different from the fanin count (%d).", Io_MvGetLine(p, pProduct), pProduct, nFanins );
+            return 0;
         }
         c = pOutput[0];
         if ( (c!='0'&&c!='1'&&c!='x'&&c!='n') || pOutput[1] )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(p->pMan, pProduct), pOutput );
-            return NULL;
+            if ( pError )
+                sprintf( pError, "Line %d: Output value \"%s\" is incorrect.", Io_MvGetLine(p, pProduct), pOutput );
+            return 0;
         }
         if ( Polarity == -1 )
             Polarity = (c=='1' || c=='x');
         else if ( Polarity != (c=='1' || c=='x') )
         {
-            sprintf( p->pMan->sError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(p->pMan, pProduct), pOutput, Polarity );
-            return NULL;
+            if ( pError )
+                sprintf( pError, "Line %d: Output value \"%s\" differs from the value in the first line of the table (%d).", Io_MvGetLine(p, pProduct), pOutput, Polarity );
+            return 0;
         }
         // parse one product 
         Vec_StrPrintStr( vFunc, pProduct );
@@ -2057,6 +2097,15 @@ static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
         Vec_StrPush( vFunc, '\n' );
     }
     Vec_StrPush( vFunc, '\0' );
+    return 1;
+}
+static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
+{
+    Vec_Str_t * vFunc = p->pMan->vFunc;
+    p->pMan->nTablesRead++;
+    Vec_StrClear( vFunc );
+    if ( !Io_MvParseTableBlifInt( p->pMan, p->pMan->vTokens, vFunc, pTable, nFanins, p->pMan->sError ) )
+        return NULL;
     return Vec_StrArray( vFunc );
 }
 
@@ -2064,20 +2113,25 @@ static char * Io_MvParseTableBlif( Io_MvMod_t * p, char * pTable, int nFanins )
 
   Synopsis    [Parses the nodes line.]
 
-  Description []
+  Description [If pLineEnd is not NULL, the line was already split into 
+  tokens by Io_MvParseTablesBlifPar(). If pSop is not NULL, it is the
+  SOP cover of the table derived by Io_MvParseTablesBlifPar().]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
+static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine, char * pLineEnd, char * pSop )
 {
     Vec_Ptr_t * vTokens = p->pMan->vTokens;
     Abc_Obj_t * pNet, * pNode;
     char * pName;
     assert( !p->pMan->fBlifMv );
-    Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
+    if ( pLineEnd )
+        Io_MvCollectTokens( vTokens, pLine, pLineEnd );
+    else
+        Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
     // parse the mapped node
     if ( !strcmp((char *)Vec_PtrEntry(vTokens,0), "gate") )
         return Io_MvParseLineGateBlif( p, vTokens );
@@ -2092,14 +2146,138 @@ static int Io_MvParseLineNamesBlif( Io_MvMod_t * p, char * pLine )
     }
     // create fanins
     pNode = Io_ReadCreateNode( p->pNtk, pName, (char **)(vTokens->pArray + 1), Vec_PtrSize(vTokens) - 2 );
-    // parse the table of this node
-    pNode->pData = Io_MvParseTableBlif( p, pName + strlen(pName), Abc_ObjFaninNum(pNode) );
-    if ( pNode->pData == NULL )
+    // parse the table of this node (re-parsing the table to get the error message)
+    if ( pSop == NULL )
+        pSop = Io_MvParseTableBlif( p, pName + strlen(pName), Abc_ObjFaninNum(pNode) );
+    else
+        p->pMan->nTablesRead++;
+    if ( pSop == NULL )
         return 0;
-    pNode->pData = Abc_SopRegister( (Mem_Flex_t *)p->pNtk->pManFunc, (char *)pNode->pData );
+    pNode->pData = Abc_SopRegister( (Mem_Flex_t *)p->pNtk->pManFunc, pSop );
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Frees the results of concurrent parsing of the tables.]
+
+  Description []
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_MvStopTablesBlifPar( Io_MvMan_t * p )
+{
+    Vec_Str_t * vArena;
+    int i;
+    if ( p->vArenas )
+    {
+        Vec_PtrForEachEntry( Vec_Str_t *, p->vArenas, vArena, i )
+            Vec_StrFree( vArena );
+        Vec_PtrFreeP( &p->vArenas );
+    }
+    Vec_PtrFreeP( &p->vLineEnds );
+    Vec_PtrFreeP( &p->vSops );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tokenizes the .names lines and parses their tables concurrently.]
+
+  Description [Each thread processes a contiguous range of the .names lines
+  of the model. The lines are split into tokens in place and the SOP covers
+  are written into the storage owned by the thread. Creating the nets and 
+  the nodes is left for Io_MvParseLineNamesBlif(), which is called in the 
+  original order of the lines. The tables that fail to parse get a NULL 
+  cover and are parsed again by Io_MvParseLineNamesBlif() to report the error.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+static void Io_MvParseTablesBlifPar( Io_MvMod_t * p ) {}
+
+#else // pthreads are used
+
+typedef struct Io_MvThData_t_
+{
+    Io_MvMod_t *         pMod;         // the model
+    int                  iBeg;         // the first line
+    int                  iEnd;         // the line following the last one
+    Vec_Ptr_t *          vTokens;      // the tokens of the thread
+    Vec_Str_t *          vArena;       // the SOP covers of the thread
+    Vec_Int_t *          vOffsets;     // the offsets of the SOP covers in the arena
+} Io_MvThData_t;
+
+static void * Io_MvWorkerThread( void * pArg )
+{
+    Io_MvThData_t * pThData = (Io_MvThData_t *)pArg;
+    Io_MvMan_t * p = pThData->pMod->pMan;
+    Vec_Ptr_t * vTokens = pThData->vTokens;
+    char * pLine, * pName;
+    int i, Offset;
+    for ( i = pThData->iBeg; i < pThData->iEnd; i++ )
+    {
+        pLine = (char *)Vec_PtrEntry( pThData->pMod->vNames, i );
+        Vec_PtrWriteEntry( p->vLineEnds, i, pLine + strlen(pLine) );
+        Io_MvSplitIntoTokens( vTokens, pLine, '\0' );
+        if ( Vec_PtrSize(vTokens) < 2 || strcmp((char *)Vec_PtrEntry(vTokens,0), "names") )
+            continue;
+        pName  = (char *)Vec_PtrEntryLast( vTokens );
+        Offset = Vec_StrSize( pThData->vArena );
+        if ( Io_MvParseTableBlifInt( p, vTokens, pThData->vArena, pName + strlen(pName), Vec_PtrSize(vTokens) - 2, NULL ) )
+            Vec_IntWriteEntry( pThData->vOffsets, i, Offset );
+        else
+            Vec_StrShrink( pThData->vArena, Offset );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+static void Io_MvParseTablesBlifPar( Io_MvMod_t * p )
+{
+    Io_MvMan_t * pMan = p->pMan;
+    Io_MvThData_t ThData[IO_BLIFMV_THR_MAX];
+    pthread_t WorkerThread[IO_BLIFMV_THR_MAX];
+    Vec_Int_t * vOffsets;
+    int i, k, status, Offset, nLines = Vec_PtrSize(p->vNames);
+    int nProcs = Abc_MinInt( pMan->nProcs, IO_BLIFMV_THR_MAX );
+    assert( pMan->vLineEnds == NULL && pMan->vSops == NULL );
+    pMan->vLineEnds = Vec_PtrStart( nLines );
+    pMan->vSops     = Vec_PtrStart( nLines );
+    pMan->vArenas   = Vec_PtrAlloc( nProcs );
+    vOffsets        = Vec_IntStartFull( nLines );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMod     = p;
+        ThData[i].iBeg     = (int)((word)nLines * i / nProcs);
+        ThData[i].iEnd     = (int)((word)nLines * (i+1) / nProcs);
+        ThData[i].vTokens  = Vec_PtrAlloc( 512 );
+        ThData[i].vArena   = Vec_StrAlloc( 1 << 16 );
+        ThData[i].vOffsets = vOffsets;
+        Vec_PtrPush( pMan->vArenas, ThData[i].vArena );
+        status = pthread_create( WorkerThread + i, NULL, Io_MvWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        // the arena of the thread does not change any more
+        for ( k = ThData[i].iBeg; k < ThData[i].iEnd; k++ )
+            if ( (Offset = Vec_IntEntry(vOffsets, k)) >= 0 )
+                Vec_PtrWriteEntry( pMan->vSops, k, Vec_StrEntryP(ThData[i].vArena, Offset) );
+        Vec_PtrFree( ThData[i].vTokens );
+    }
+    Vec_IntFree( vOffsets );
+}
+
+#endif // pthreads are used
+
 ABC_NAMESPACE_IMPL_END
 
 #include "map/mio/mio.h"
@@ -0,0 +1,621 @@
+/**CFile****************************************************************
+
+  FileName    [ioSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Saving and loading the binary snapshot of the ABC state.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: ioSnap.c,v 1.00 2026/10/17 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "ioAbc.h"
+#include "base/main/mainInt.h"
+#include "aig/gia/gia.h"
+#include "map/mio/mio.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IO_SNAP_MAGIC     "ABCSNAP"   // the first 8 bytes of the file
+#define IO_SNAP_VERSION   1           // incremented when the format changes
+
+// the snapshot is the header followed by the records
+// each record starts with its tag; the records are terminated by IO_SNAP_END
+typedef enum {
+    IO_SNAP_END = 0,         // 0: the end of the records
+    IO_SNAP_NTK,             // 1: the current network
+    IO_SNAP_STORE,           // 2: the network in the storage for choicing
+    IO_SNAP_GIA,             // 3: the current AIG
+    IO_SNAP_CEX,             // 4: the current counter-example
+    IO_SNAP_STATUS           // 5: the verification status
+} Io_SnapTag_t;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writing and reading primitives.]
+
+  Description [The readers do not go beyond the end of the snapshot.
+  If the data is not available, they set the position to NULL and return
+  0 or NULL; the following reads then fail as well.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Io_SnapPutInt( FILE * pFile, int Num )
+{
+    fwrite( &Num, sizeof(int), 1, pFile );
+}
+static inline void Io_SnapPutStr( FILE * pFile, char * pStr )
+{
+    Io_SnapPutInt( pFile, pStr ? (int)strlen(pStr) + 1 : 0 );
+    if ( pStr )
+        fwrite( pStr, 1, strlen(pStr) + 1, pFile );
+}
+static inline int Io_SnapGetInt( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    int Num;
+    if ( *ppPos == NULL || pEnd - *ppPos < (int)sizeof(int) )
+    {
+        *ppPos = NULL;
+        return 0;
+    }
+    memcpy( &Num, *ppPos, sizeof(int) );
+    *ppPos += sizeof(int);
+    return Num;
+}
+static inline char * Io_SnapGetStr( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    int nSize = Io_SnapGetInt( ppPos, pEnd );
+    char * pStr;
+    if ( *ppPos == NULL || nSize < 0 || nSize > pEnd - *ppPos || (nSize > 0 && (*ppPos)[nSize-1] != 0) )
+    {
+        *ppPos = NULL;
+        return NULL;
+    }
+    pStr = nSize ? (char *)*ppPos : NULL;
+    *ppPos += nSize;
+    return pStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the network into the snapshot.]
+
+  Description [Each object is saved as its type, fanins, function, and
+  name. The AND nodes of the strashed network are saved in topological
+  order, so that they can be re-hashed when loading. The logic functions
+  represented as BDDs or AIGs are saved as SOPs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Io_SnapWriteObjList( FILE * pFile, Vec_Ptr_t * vList, Vec_Int_t * vMap )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    Io_SnapPutInt( pFile, Vec_PtrSize(vList) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vList, pObj, i )
+        Io_SnapPutInt( pFile, Vec_IntEntry(vMap, Abc_ObjId(pObj)) );
+}
+void Io_SnapWriteNtk( Abc_Ntk_t * pNtk, FILE * pFile )
+{
+    Abc_Ntk_t * pTemp = NULL;
+    Vec_Ptr_t * vObjs, * vNodes;
+    Vec_Int_t * vMap;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k;
+    if ( !Abc_NtkIsStrash(pNtk) && (Abc_NtkHasBdd(pNtk) || Abc_NtkHasAig(pNtk)) )
+    {
+        pNtk = pTemp = Abc_NtkDup( pNtk );
+        Abc_NtkToSop( pNtk, -1, ABC_INFINITY );
+    }
+    // order the objects
+    vObjs = Vec_PtrAlloc( Abc_NtkObjNum(pNtk) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( !Abc_ObjIsNode(pObj) )
+            Vec_PtrPush( vObjs, pObj );
+    if ( Abc_NtkIsStrash(pNtk) )
+    {
+        vNodes = Abc_AigDfs( pNtk, 1, 0 );
+        Vec_PtrAppend( vObjs, vNodes );
+        Vec_PtrFree( vNodes );
+    }
+    else
+        Abc_NtkForEachNode( pNtk, pObj, i )
+            Vec_PtrPush( vObjs, pObj );
+    vMap = Vec_IntStartFull( Abc_NtkObjNumMax(pNtk) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+        Vec_IntWriteEntry( vMap, Abc_ObjId(pObj), i );
+    // write the network
+    Io_SnapPutInt( pFile, pNtk->ntkType );
+    Io_SnapPutInt( pFile, pNtk->ntkFunc );
+    Io_SnapPutInt( pFile, pNtk->nConstrs );
+    Io_SnapPutStr( pFile, pNtk->pName );
+    Io_SnapPutStr( pFile, pNtk->pSpec );
+    Io_SnapPutInt( pFile, Vec_PtrSize(vObjs) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+    {
+        Io_SnapPutInt( pFile, pObj->Type );
+        Io_SnapPutInt( pFile, Abc_ObjFaninNum(pObj) );
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Io_SnapPutInt( pFile, Abc_Var2Lit(Vec_IntEntry(vMap, Abc_ObjId(pFanin)), Abc_NtkIsStrash(pNtk) && Abc_ObjFaninC(pObj, k)) );
+        if ( Abc_ObjIsNode(pObj) && Abc_NtkIsStrash(pNtk) )
+            Io_SnapPutInt( pFile, pObj->pData ? Vec_IntEntry(vMap, Abc_ObjId((Abc_Obj_t *)pObj->pData)) : -1 );
+        else if ( Abc_ObjIsNode(pObj) && Abc_NtkHasSop(pNtk) )
+            Io_SnapPutStr( pFile, (char *)pObj->pData );
+        else if ( Abc_ObjIsNode(pObj) && Abc_NtkHasMapping(pNtk) )
+            Io_SnapPutStr( pFile, pObj->pData ? Mio_GateReadName((Mio_Gate_t *)pObj->pData) : NULL );
+        else if ( Abc_ObjIsLatch(pObj) )
+            Io_SnapPutInt( pFile, Abc_LatchInit(pObj) );
+        Io_SnapPutStr( pFile, Nm_ManFindNameById(pNtk->pManName, Abc_ObjId(pObj)) );
+    }
+    // write the order of the terminals
+    Io_SnapWriteObjList( pFile, pNtk->vPis, vMap );
+    Io_SnapWriteObjList( pFile, pNtk->vPos, vMap );
+    Io_SnapWriteObjList( pFile, pNtk->vCis, vMap );
+    Io_SnapWriteObjList( pFile, pNtk->vCos, vMap );
+    Io_SnapWriteObjList( pFile, pNtk->vBoxes, vMap );
+    Vec_IntFree( vMap );
+    Vec_PtrFree( vObjs );
+    if ( pTemp )
+        Abc_NtkDelete( pTemp );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the network from the snapshot.]
+
+  Description [Returns NULL if the network cannot be reconstructed.
+  The object types, the fanins, and the terminal lists are checked
+  before they are used, so that a corrupted snapshot is rejected.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Io_SnapReadObjList( unsigned char ** ppPos, unsigned char * pEnd, Vec_Ptr_t * vList, Vec_Ptr_t * vObjs, int (*pFuncIs)(Abc_Obj_t *), int nItemsAll )
+{
+    Abc_Obj_t * pObj;
+    int i, iObj, nItems = Io_SnapGetInt( ppPos, pEnd );
+    Vec_PtrClear( vList );
+    // the list contains each object of its kind exactly once
+    if ( *ppPos == NULL || nItems != nItemsAll || nItems > (pEnd - *ppPos) / (int)sizeof(int) )
+    {
+        *ppPos = NULL;
+        return;
+    }
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+        pObj->fMarkA = 0;
+    for ( i = 0; i < nItems; i++ )
+    {
+        iObj = Io_SnapGetInt( ppPos, pEnd );
+        pObj = (*ppPos && iObj >= 0 && iObj < Vec_PtrSize(vObjs)) ? (Abc_Obj_t *)Vec_PtrEntry(vObjs, iObj) : NULL;
+        if ( pObj == NULL || !pFuncIs(pObj) || pObj->fMarkA )
+        {
+            *ppPos = NULL;
+            return;
+        }
+        pObj->fMarkA = 1;
+        Vec_PtrPush( vList, pObj );
+    }
+}
+static inline int Io_SnapObjTypeIsValid( Abc_Ntk_t * pNtk, int Type, int nFanins )
+{
+    if ( Type <= ABC_OBJ_NONE || Type >= ABC_OBJ_NUMBER )
+        return 0;
+    if ( Type == ABC_OBJ_CONST1 )
+        return Abc_NtkIsStrash(pNtk) && nFanins == 0;
+    if ( Type == ABC_OBJ_NODE && Abc_NtkIsStrash(pNtk) )
+        return nFanins == 2;
+    if ( Type == ABC_OBJ_PI )
+        return nFanins == 0;
+    if ( Type == ABC_OBJ_PO || Type == ABC_OBJ_BI || Type == ABC_OBJ_BO || Type == ABC_OBJ_LATCH )
+        return nFanins == 1;
+    return 1;
+}
+static inline int Io_SnapFaninIsValid( int Type, Abc_Obj_t * pFanin )
+{
+    if ( Type == ABC_OBJ_BO )
+        return Abc_ObjIsBox(pFanin);
+    if ( Type == ABC_OBJ_LATCH || Type == ABC_OBJ_WHITEBOX || Type == ABC_OBJ_BLACKBOX )
+        return Abc_ObjIsBi(pFanin);
+    return !Abc_ObjIsCo(pFanin) && !Abc_ObjIsBox(pFanin);
+}
+Abc_Ntk_t * Io_SnapReadNtk( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj, * pFanin0, * pFanin1;
+    Vec_Ptr_t * vObjs;
+    Vec_Int_t * vFanins, * vStarts, * vEquivs;
+    unsigned char * pCur = *ppPos;
+    int i, k, Type, Func, nObjs, nObjsOld, nFanins, Lit, Equiv, fFailed = 0;
+    char * pStr;
+    Type = Io_SnapGetInt( &pCur, pEnd );
+    Func = Io_SnapGetInt( &pCur, pEnd );
+    if ( pCur == NULL || Type <= ABC_NTK_NONE || Type >= ABC_NTK_OTHER || Func <= ABC_FUNC_NONE || Func >= ABC_FUNC_OTHER ||
+         Func == ABC_FUNC_BDD || (Type == ABC_NTK_STRASH) != (Func == ABC_FUNC_AIG) )
+    {
+        printf( "Io_SnapReadNtk(): The snapshot of the network is corrupted.\n" );
+        return NULL;
+    }
+    if ( Func == ABC_FUNC_MAP && Abc_FrameReadLibGen() == NULL )
+    {
+        printf( "Io_SnapReadNtk(): The mapped network cannot be loaded because the library is not available.\n" );
+        return NULL;
+    }
+    pNtk = Abc_NtkAlloc( (Abc_NtkType_t)Type, (Abc_NtkFunc_t)Func, 1 );
+    pNtk->nConstrs = Io_SnapGetInt( &pCur, pEnd );
+    pNtk->pName = Abc_UtilStrsav( Io_SnapGetStr(&pCur, pEnd) );
+    pNtk->pSpec = Abc_UtilStrsav( Io_SnapGetStr(&pCur, pEnd) );
+    // each object takes at least three numbers (type, fanin count, name size)
+    nObjs = Io_SnapGetInt( &pCur, pEnd );
+    if ( pCur == NULL || nObjs < 0 || nObjs > (pEnd - pCur) / (3 * (int)sizeof(int)) )
+    {
+        printf( "Io_SnapReadNtk(): The snapshot of the network is corrupted.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    // create the objects
+    vObjs   = Vec_PtrStart( nObjs );
+    vFanins = Vec_IntAlloc( 2 * nObjs );
+    vStarts = Vec_IntAlloc( nObjs + 1 );
+    vEquivs = Vec_IntStartFull( nObjs );
+    for ( i = 0; i < nObjs; i++ )
+    {
+        Type    = Io_SnapGetInt( &pCur, pEnd );
+        nFanins = Io_SnapGetInt( &pCur, pEnd );
+        if ( pCur == NULL || nFanins < 0 || nFanins > (pEnd - pCur) / (int)sizeof(int) || !Io_SnapObjTypeIsValid(pNtk, Type, nFanins) )
+        {
+            pCur = NULL;
+            break;
+        }
+        Vec_IntPush( vStarts, Vec_IntSize(vFanins) );
+        for ( k = 0; k < nFanins; k++ )
+        {
+            Lit = Io_SnapGetInt( &pCur, pEnd );
+            // only the strashed network has complemented edges
+            if ( Lit < 0 || Abc_Lit2Var(Lit) >= nObjs || (Abc_LitIsCompl(Lit) && !Abc_NtkIsStrash(pNtk)) )
+                pCur = NULL;
+            Vec_IntPush( vFanins, Lit );
+        }
+        if ( pCur == NULL )
+            break;
+        if ( Type == ABC_OBJ_NODE && Abc_NtkIsStrash(pNtk) )
+        {
+            // the fanins precede the node in the topological order
+            Equiv = Io_SnapGetInt( &pCur, pEnd );
+            if ( pCur == NULL || Equiv < -1 || Equiv >= nObjs )
+            {
+                pCur = NULL;
+                break;
+            }
+            Vec_IntWriteEntry( vEquivs, i, Equiv );
+            Lit = Vec_IntEntry( vFanins, Vec_IntEntryLast(vStarts) );
+            pFanin0 = Abc_Lit2Var(Lit) < i ? Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, Abc_Lit2Var(Lit)), Abc_LitIsCompl(Lit) ) : NULL;
+            Lit = Vec_IntEntry( vFanins, Vec_IntEntryLast(vStarts) + 1 );
+            pFanin1 = Abc_Lit2Var(Lit) < i ? Abc_ObjNotCond( (Abc_Obj_t *)Vec_PtrEntry(vObjs, Abc_Lit2Var(Lit)), Abc_LitIsCompl(Lit) ) : NULL;
+            if ( pFanin0 == NULL || pFanin1 == NULL || !Io_SnapFaninIsValid(Type, Abc_ObjRegular(pFanin0)) || !Io_SnapFaninIsValid(Type, Abc_ObjRegular(pFanin1)) )
+            {
+                pCur = NULL;
+                break;
+            }
+            // the node should be new (not a constant, a fanin, or a duplicate)
+            nObjsOld = Abc_NtkObjNumMax( pNtk );
+            pObj = Abc_AigAnd( (Abc_Aig_t *)pNtk->pManFunc, pFanin0, pFanin1 );
+            if ( Abc_ObjIsComplement(pObj) || Abc_ObjId(pObj) < nObjsOld )
+            {
+                pCur = NULL;
+                break;
+            }
+        }
+        else if ( Type == ABC_OBJ_CONST1 )
+            pObj = Abc_AigConst1( pNtk );
+        else
+        {
+            pObj = Abc_NtkCreateObj( pNtk, (Abc_ObjType_t)Type );
+            if ( Type == ABC_OBJ_NODE && Abc_NtkHasSop(pNtk) )
+            {
+                if ( (pStr = Io_SnapGetStr(&pCur, pEnd)) == NULL )
+                {
+                    pCur = NULL;
+                    break;
+                }
+                pObj->pData = Abc_SopRegister( (Mem_Flex_t *)pNtk->pManFunc, pStr );
+            }
+            else if ( Type == ABC_OBJ_NODE && Abc_NtkHasMapping(pNtk) )
+            {
+                pStr = Io_SnapGetStr( &pCur, pEnd );
+                pObj->pData = pStr ? Mio_LibraryReadGateByName( (Mio_Library_t *)pNtk->pManFunc, pStr, NULL ) : NULL;
+                if ( pStr && pObj->pData == NULL && !fFailed )
+                {
+                    printf( "Io_SnapReadNtk(): Cannot find gate \"%s\" in the current library.\n", pStr );
+                    fFailed = 1;
+                }
+            }
+            else if ( Type == ABC_OBJ_LATCH )
+                pObj->pData = (void *)(ABC_PTRINT_T)Io_SnapGetInt( &pCur, pEnd );
+        }
+        if ( (pStr = Io_SnapGetStr(&pCur, pEnd)) )
+            Abc_ObjAssignName( pObj, pStr, NULL );
+        if ( pCur == NULL )
+            break;
+        Vec_PtrWriteEntry( vObjs, i, pObj );
+    }
+    Vec_IntPush( vStarts, Vec_IntSize(vFanins) );
+    // connect the objects (all of them have been created)
+    if ( pCur != NULL )
+    {
+        Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+        {
+            if ( Abc_ObjIsNode(pObj) && Abc_NtkIsStrash(pNtk) )
+            {
+                if ( Vec_IntEntry(vEquivs, i) >= 0 )
+                    pObj->pData = Vec_PtrEntry( vObjs, Vec_IntEntry(vEquivs, i) );
+                continue;
+            }
+            for ( k = Vec_IntEntry(vStarts, i); k < Vec_IntEntry(vStarts, i+1); k++ )
+            {
+                Lit = Vec_IntEntry( vFanins, k );
+                pFanin0 = (Abc_Obj_t *)Vec_PtrEntry( vObjs, Abc_Lit2Var(Lit) );
+                if ( !Io_SnapFaninIsValid(pObj->Type, pFanin0) )
+                {
+                    pCur = NULL;
+                    break;
+                }
+                Abc_ObjAddFanin( pObj, Abc_ObjNotCond(pFanin0, Abc_LitIsCompl(Lit)) );
+            }
+            if ( pCur == NULL )
+                break;
+        }
+    }
+    // restore the order of the terminals (the lists already hold
+    // the terminals in the order of creation, which gives their sizes)
+    if ( pCur != NULL )
+    {
+        Io_SnapReadObjList( &pCur, pEnd, pNtk->vPis, vObjs, Abc_ObjIsPi, Abc_NtkPiNum(pNtk) );
+        Io_SnapReadObjList( &pCur, pEnd, pNtk->vPos, vObjs, Abc_ObjIsPo, Abc_NtkPoNum(pNtk) );
+        Io_SnapReadObjList( &pCur, pEnd, pNtk->vCis, vObjs, Abc_ObjIsCi, Abc_NtkCiNum(pNtk) );
+        Io_SnapReadObjList( &pCur, pEnd, pNtk->vCos, vObjs, Abc_ObjIsCo, Abc_NtkCoNum(pNtk) );
+        Io_SnapReadObjList( &pCur, pEnd, pNtk->vBoxes, vObjs, Abc_ObjIsBox, Abc_NtkBoxNum(pNtk) );
+        Abc_NtkCleanMarkA( pNtk );
+    }
+    Vec_PtrFree( vObjs );
+    Vec_IntFree( vFanins );
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vEquivs );
+    if ( pCur == NULL )
+    {
+        printf( "Io_SnapReadNtk(): The snapshot of the network is corrupted.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    *ppPos = pCur;
+    if ( fFailed || !Abc_NtkCheckRead(pNtk) )
+    {
+        printf( "Io_SnapReadNtk(): Network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the state of the ABC framework into a binary file.]
+
+  Description [The snapshot contains the current network, the networks
+  stored for choicing, the current AIG with its attributes (mapping,
+  equivalences, choices, timing, etc), the counter-example, and the
+  verification status. The snapshot is written into a temporary file,
+  which replaces the old snapshot only if writing has succeeded.
+  Returns 1 if successful.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteSnapshot( Abc_Frame_t * pAbc, char * pFileName )
+{
+    Abc_Ntk_t * pNtk;
+    char pMagic[8] = IO_SNAP_MAGIC;
+    char * pFileTemp;
+    FILE * pFile;
+    int i, RetValue;
+    pFileTemp = Abc_UtilStrsavTwo( pFileName, (char *)".tmp" );
+    pFile = fopen( pFileTemp, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Io_WriteSnapshot(): Cannot open the output file \"%s\".\n", pFileTemp );
+        ABC_FREE( pFileTemp );
+        return 0;
+    }
+    fwrite( pMagic, 1, 8, pFile );
+    Io_SnapPutInt( pFile, IO_SNAP_VERSION );
+    if ( pAbc->pNtkCur )
+    {
+        Io_SnapPutInt( pFile, IO_SNAP_NTK );
+        Io_SnapWriteNtk( pAbc->pNtkCur, pFile );
+    }
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pAbc->vStore, pNtk, i )
+    {
+        Io_SnapPutInt( pFile, IO_SNAP_STORE );
+        Io_SnapWriteNtk( pNtk, pFile );
+    }
+    if ( pAbc->pGia )
+    {
+        Io_SnapPutInt( pFile, IO_SNAP_GIA );
+        Gia_ManSnapWrite( pAbc->pGia, pFile );
+    }
+    if ( pAbc->pCex )
+    {
+        Io_SnapPutInt( pFile, IO_SNAP_CEX );
+        Io_SnapPutInt( pFile, (int)sizeof(Abc_Cex_t) + (int)sizeof(unsigned) * Abc_BitWordNum(pAbc->pCex->nBits) );
+        fwrite( pAbc->pCex, 1, sizeof(Abc_Cex_t) + sizeof(unsigned) * Abc_BitWordNum(pAbc->pCex->nBits), pFile );
+    }
+    Io_SnapPutInt( pFile, IO_SNAP_STATUS );
+    Io_SnapPutInt( pFile, pAbc->Status );
+    Io_SnapPutInt( pFile, pAbc->nFrames );
+    Io_SnapPutInt( pFile, IO_SNAP_END );
+    RetValue = !ferror( pFile );
+    if ( fclose( pFile ) != 0 )
+        RetValue = 0;
+#ifdef _WIN32
+    // rename() does not replace the existing file on Windows
+    if ( RetValue )
+        remove( pFileName );
+#endif
+    if ( RetValue && rename( pFileTemp, pFileName ) != 0 )
+        RetValue = 0;
+    if ( !RetValue )
+    {
+        printf( "Io_WriteSnapshot(): Writing the file \"%s\" has failed.\n", pFileName );
+        remove( pFileTemp );
+    }
+    ABC_FREE( pFileTemp );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the state of the ABC framework from a binary file.]
+
+  Description [The file is memory-mapped and the object arrays are copied
+  as they are. The components present in the snapshot replace those of
+  the framework only if the whole snapshot is loaded successfully.
+  Returns 1 if successful.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadSnapshot( Abc_Frame_t * pAbc, char * pFileName )
+{
+    Abc_Ntk_t * pNtk = NULL, * pTemp;
+    Vec_Ptr_t * vStore = Vec_PtrAlloc( 4 );
+    Gia_Man_t * pGia = NULL;
+    Abc_Cex_t * pCex = NULL;
+    unsigned char * pCur, * pEnd;
+    char * pContents;
+    size_t nFileSize;
+    int i, Tag = -1, nSize, Status = -1, nFrames = -1, fMapped, fStatus = 0;
+    pContents = Gia_FileMap( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
+    {
+        Vec_PtrFree( vStore );
+        return 0;
+    }
+    pCur = (unsigned char *)pContents;
+    pEnd = pCur + nFileSize;
+    if ( nFileSize < 12 || strncmp(pContents, IO_SNAP_MAGIC, 8) )
+        printf( "Io_ReadSnapshot(): The file \"%s\" is not an ABC snapshot.\n", pFileName );
+    else if ( (pCur += 8, Io_SnapGetInt(&pCur, pEnd)) != IO_SNAP_VERSION )
+        printf( "Io_ReadSnapshot(): The snapshot \"%s\" has unsupported version.\n", pFileName );
+    else
+    {
+        while ( (Tag = Io_SnapGetInt(&pCur, pEnd)) != IO_SNAP_END )
+        {
+            if ( Tag == IO_SNAP_NTK && pNtk == NULL )
+            {
+                if ( (pNtk = Io_SnapReadNtk(&pCur, pEnd)) == NULL )
+                    break;
+            }
+            else if ( Tag == IO_SNAP_STORE )
+            {
+                if ( (pTemp = Io_SnapReadNtk(&pCur, pEnd)) == NULL )
+                    break;
+                Vec_PtrPush( vStore, pTemp );
+            }
+            else if ( Tag == IO_SNAP_GIA && pGia == NULL )
+            {
+                if ( (pGia = Gia_ManSnapRead(&pCur, pEnd)) == NULL )
+                    break;
+            }
+            else if ( Tag == IO_SNAP_CEX && pCex == NULL )
+            {
+                nSize = Io_SnapGetInt( &pCur, pEnd );
+                if ( pCur == NULL || nSize < (int)sizeof(Abc_Cex_t) || nSize > pEnd - pCur )
+                    break;
+                pCex = (Abc_Cex_t *)ABC_ALLOC( char, nSize );
+                memcpy( pCex, pCur, (size_t)nSize );
+                pCur += nSize;
+                // the size should agree with the number of bits
+                if ( pCex->nBits < 0 || nSize != (int)sizeof(Abc_Cex_t) + (int)sizeof(unsigned) * Abc_BitWordNum(pCex->nBits) )
+                    break;
+            }
+            else if ( Tag == IO_SNAP_STATUS )
+            {
+                Status  = Io_SnapGetInt( &pCur, pEnd );
+                nFrames = Io_SnapGetInt( &pCur, pEnd );
+                fStatus = 1;
+            }
+            else
+                break;
+        }
+        if ( pCur == NULL || Tag != IO_SNAP_END )
+            printf( "Io_ReadSnapshot(): Cannot load the snapshot \"%s\".\n", pFileName );
+    }
+    Gia_FileUnmap( pContents, nFileSize, fMapped );
+    if ( pCur == NULL || Tag != IO_SNAP_END )
+    {
+        if ( pNtk ) Abc_NtkDelete( pNtk );
+        Vec_PtrForEachEntry( Abc_Ntk_t *, vStore, pTemp, i )
+            Abc_NtkDelete( pTemp );
+        Vec_PtrFree( vStore );
+        Gia_ManStopP( &pGia );
+        ABC_FREE( pCex );
+        return 0;
+    }
+    // update the framework
+    if ( pNtk )
+        Abc_FrameReplaceCurrentNetwork( pAbc, pNtk );
+    if ( Vec_PtrSize(vStore) > 0 )
+    {
+        Abc_NtkFraigStoreClean();
+        Vec_PtrForEachEntry( Abc_Ntk_t *, vStore, pTemp, i )
+            Vec_PtrPush( pAbc->vStore, pTemp );
+    }
+    Vec_PtrFree( vStore );
+    if ( pGia )
+        Abc_FrameUpdateGia( pAbc, pGia );
+    if ( fStatus )
+    {
+        Abc_FrameReplaceCex( pAbc, &pCex );
+        pAbc->Status  = Status;
+        pAbc->nFrames = nFrames;
+    }
+    ABC_FREE( pCex );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
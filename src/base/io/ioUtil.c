@@ -96,7 +96,7 @@ Io_FileType_t Io_ReadFileType( char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck )
+Abc_Ntk_t * Io_ReadNetlistPar( char * pFileName, Io_FileType_t FileType, int fCheck, int nProcs )
 {
     FILE * pFile;
     Abc_Ntk_t * pNtk;
@@ -135,7 +135,7 @@ Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck
     // read the new netlist
     if ( FileType == IO_FILE_BLIF )
 //        pNtk = Io_ReadBlif( pFileName, fCheck );
-        pNtk = Io_ReadBlifMv( pFileName, 0, fCheck );
+        pNtk = Io_ReadBlifMvPar( pFileName, 0, fCheck, nProcs );
     else if ( Io_ReadFileType(pFileName) == IO_FILE_BLIFMV )
         pNtk = Io_ReadBlifMv( pFileName, 1, fCheck );
     else if ( FileType == IO_FILE_BENCH )
@@ -176,6 +176,10 @@ Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck
     }
     return pNtk;
 }
+Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck )
+{
+    return Io_ReadNetlistPar( pFileName, FileType, fCheck, 1 );
+}
 
 /**Function*************************************************************
 
@@ -238,12 +242,12 @@ void updateLtlStoreOfNtk( Abc_Ntk_t *pNtk, Vec_Ptr_t *tempLtlStore )
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs )
+Abc_Ntk_t * Io_ReadPar( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs, int nProcs )
 {
     Abc_Ntk_t * pNtk, * pTemp;
     Vec_Ptr_t * vLtl;
     // get the netlist
-    pNtk = Io_ReadNetlist( pFileName, FileType, fCheck );
+    pNtk = Io_ReadNetlistPar( pFileName, FileType, fCheck, nProcs );
     if ( pNtk == NULL )
         return NULL;
     vLtl = temporaryLtlStore( pNtk );
@@ -305,6 +309,10 @@ Abc_Ntk_t * Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int f
     }
     return pNtk;
 }
+Abc_Ntk_t * Io_Read( char * pFileName, Io_FileType_t FileType, int fCheck, int fBarBufs )
+{
+    return Io_ReadPar( pFileName, FileType, fCheck, fBarBufs, 1 );
+}
 
 /**Function*************************************************************
 
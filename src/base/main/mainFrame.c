@@ -164,6 +164,7 @@ Abc_Frame_t * Abc_FrameAllocate()
     Abc_Frame_t * p;
     extern void define_cube_size( int n );
     extern void set_espresso_flags();
+    extern void Abc_TtSimdStart();
     // allocate and clean
     p = ABC_CALLOC( Abc_Frame_t, 1 );
     // get version
@@ -186,6 +187,8 @@ Abc_Frame_t * Abc_FrameAllocate()
     // initialize the trace manager
 //    Abc_HManStart();
     p->vPlugInComBinPairs = Vec_PtrAlloc( 100 );
+    // select the truth table kernels for this CPU
+    Abc_TtSimdStart();
     return p;
 }
 
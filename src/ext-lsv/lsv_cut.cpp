@@ -0,0 +1,194 @@
+#include "base/abc/abc.h"
+#include "misc/util/utilTruth.h"
+#include "misc/vec/vec.h"
+#include "lsv_cut.h"
+
+// Creates the cut manager; cuts are not computed until Lsv_CutManCompute() is called
+Lsv_CutMan_t* Lsv_CutManStart(Abc_Ntk_t* pNtk, int nLeafMax, int nCutLimit, int fDominance) {
+    Lsv_CutMan_t* p = ABC_CALLOC(Lsv_CutMan_t, 1);
+    assert(nLeafMax >= 1);
+    p->pNtk       = pNtk;
+    // a cut never has more leaves than there are objects, so larger k only wastes pool memory
+    p->nLeafMax   = Abc_MinInt(nLeafMax, Abc_MaxInt(Abc_NtkObjNumMax(pNtk), 1));
+    p->nCutLimit  = nCutLimit;
+    p->fDominance = fDominance;
+    p->nCutWords  = (int)((sizeof(Lsv_Cut_t) + sizeof(int) * p->nLeafMax + sizeof(word) - 1) / sizeof(word));
+    p->nPoolAlloc = Abc_MaxInt(1024, 2 * Abc_NtkObjNumMax(pNtk));
+    p->pPool      = ABC_ALLOC(word, (size_t)p->nPoolAlloc * p->nCutWords);
+    p->vStart     = Vec_IntStartFull(Abc_NtkObjNumMax(pNtk));
+    p->vNum       = Vec_IntStartFull(Abc_NtkObjNumMax(pNtk));
+    return p;
+}
+
+void Lsv_CutManStop(Lsv_CutMan_t* p) {
+    Vec_IntFree(p->vStart);
+    Vec_IntFree(p->vNum);
+    ABC_FREE(p->pPool);
+    ABC_FREE(p);
+}
+
+// Appends an entry to the pool; pointers into the pool are invalidated by this call
+static inline int Lsv_CutManAppend(Lsv_CutMan_t* p) {
+    if (p->nPoolCuts == p->nPoolAlloc) {
+        p->nPoolAlloc *= 2;
+        p->pPool = ABC_REALLOC(word, p->pPool, (size_t)p->nPoolAlloc * p->nCutWords);
+    }
+    return p->nPoolCuts++;
+}
+
+static inline void Lsv_CutCopy(Lsv_CutMan_t* p, Lsv_Cut_t* pDst, Lsv_Cut_t* pSrc) {
+    memcpy(pDst, pSrc, sizeof(word) * p->nCutWords);
+}
+
+// Merges two sorted leaf sets; returns 0 if the union has more than nLeafMax leaves
+static inline int Lsv_CutMerge(Lsv_Cut_t* pCut0, Lsv_Cut_t* pCut1, Lsv_Cut_t* pCut, int nLeafMax) {
+    int* pBeg = pCut->pLeaves;
+    int* pBeg0 = pCut0->pLeaves, *pEnd0 = pCut0->pLeaves + pCut0->nLeaves;
+    int* pBeg1 = pCut1->pLeaves, *pEnd1 = pCut1->pLeaves + pCut1->nLeaves;
+    pCut->uSign = pCut0->uSign | pCut1->uSign;
+    if (Abc_TtCountOnes(pCut->uSign) > nLeafMax)
+        return 0;
+    while (pBeg0 < pEnd0 && pBeg1 < pEnd1) {
+        if (pBeg - pCut->pLeaves == nLeafMax)
+            return 0;
+        if (*pBeg0 == *pBeg1)
+            *pBeg++ = *pBeg0++, pBeg1++;
+        else if (*pBeg0 < *pBeg1)
+            *pBeg++ = *pBeg0++;
+        else
+            *pBeg++ = *pBeg1++;
+    }
+    if ((pBeg - pCut->pLeaves) + (pEnd0 - pBeg0) + (pEnd1 - pBeg1) > nLeafMax)
+        return 0;
+    while (pBeg0 < pEnd0)
+        *pBeg++ = *pBeg0++;
+    while (pBeg1 < pEnd1)
+        *pBeg++ = *pBeg1++;
+    pCut->nLeaves = pBeg - pCut->pLeaves;
+    return 1;
+}
+
+// Returns 1 if the leaves of pDom are a subset of the leaves of pCut
+static inline int Lsv_CutDominates(Lsv_Cut_t* pDom, Lsv_Cut_t* pCut) {
+    int i, k = 0;
+    if (pDom->nLeaves > pCut->nLeaves || (pDom->uSign & ~pCut->uSign))
+        return 0;
+    for (i = 0; i < pDom->nLeaves; i++) {
+        while (k < pCut->nLeaves && pCut->pLeaves[k] < pDom->pLeaves[i])
+            k++;
+        if (k == pCut->nLeaves || pCut->pLeaves[k] != pDom->pLeaves[i])
+            return 0;
+    }
+    return 1;
+}
+
+// Adds the candidate cut to the cuts of the object starting at iStart, filtering dominated cuts
+static int Lsv_CutManFilter(Lsv_CutMan_t* p, int iStart, Lsv_Cut_t* pCand) {
+    int i, k;
+    // the trivial cut (first) never dominates nor is dominated by a merged cut
+    for (i = iStart + 1; i < p->nPoolCuts; i++)
+        if (Lsv_CutDominates(Lsv_CutManEntry(p, i), pCand)) {
+            p->nCutsFiltered++;
+            return 0;
+        }
+    for (i = k = iStart + 1; i < p->nPoolCuts; i++) {
+        if (Lsv_CutDominates(pCand, Lsv_CutManEntry(p, i))) {
+            p->nCutsFiltered++;
+            continue;
+        }
+        if (k < i)
+            Lsv_CutCopy(p, Lsv_CutManEntry(p, k), Lsv_CutManEntry(p, i));
+        k++;
+    }
+    p->nPoolCuts = k;
+    return 1;
+}
+
+// Computes the cuts of one object, assuming the cuts of its fanins are known
+static void Lsv_CutManComputeObj(Lsv_CutMan_t* p, Abc_Obj_t* pObj) {
+    Lsv_Cut_t* pCut;
+    int iObj = Abc_ObjId(pObj), iStart;
+    int iFan0, iFan1, nCuts0, nCuts1, i, j, iTemp;
+    if (!Abc_ObjIsCi(pObj)) {
+        if (Abc_ObjFaninNum(pObj) < 2)
+            return;
+        iFan0 = Abc_ObjFaninId0(pObj);
+        iFan1 = Abc_ObjFaninId1(pObj);
+        nCuts0 = Lsv_CutManCutNum(p, iFan0);
+        nCuts1 = Lsv_CutManCutNum(p, iFan1);
+        if (nCuts0 < 0 || nCuts1 < 0)
+            return;
+    }
+    // the trivial cut comes first
+    iStart = Lsv_CutManAppend(p);
+    pCut = Lsv_CutManEntry(p, iStart);
+    pCut->nLeaves = 1;
+    pCut->pLeaves[0] = iObj;
+    pCut->uSign = Lsv_CutLeafSign(iObj);
+    Vec_IntWriteEntry(p->vStart, iObj, iStart);
+    if (Abc_ObjIsCi(pObj)) {
+        Vec_IntWriteEntry(p->vNum, iObj, 1);
+        return;
+    }
+    // the merged cuts follow in the order of the fanin cut pairs
+    for (i = 0; i < nCuts0; i++)
+        for (j = 0; j < nCuts1; j++) {
+            if (p->nCutLimit && p->nPoolCuts - iStart == p->nCutLimit) {
+                p->nObjsLimited++;
+                goto finish;
+            }
+            iTemp = Lsv_CutManAppend(p);
+            p->nCutsMerged++;
+            if (!Lsv_CutMerge(Lsv_CutManCut(p, iFan0, i), Lsv_CutManCut(p, iFan1, j), Lsv_CutManEntry(p, iTemp), p->nLeafMax)) {
+                p->nPoolCuts--;
+                continue;
+            }
+            if (!p->fDominance)
+                continue;
+            // filtering only compacts the cuts before iTemp, so the candidate stays in place
+            p->nPoolCuts--;
+            if (!Lsv_CutManFilter(p, iStart, Lsv_CutManEntry(p, iTemp)))
+                continue;
+            if (p->nPoolCuts < iTemp)
+                Lsv_CutCopy(p, Lsv_CutManEntry(p, p->nPoolCuts), Lsv_CutManEntry(p, iTemp));
+            p->nPoolCuts++;
+        }
+finish:
+    Vec_IntWriteEntry(p->vNum, iObj, p->nPoolCuts - iStart);
+}
+
+// Collects the objects in a topological order following the fanins used by the cuts
+static void Lsv_CutManCollect_rec(Abc_Obj_t* pObj, Vec_Ptr_t* vOrder) {
+    if (Abc_NodeIsTravIdCurrent(pObj))
+        return;
+    Abc_NodeSetTravIdCurrent(pObj);
+    if (!Abc_ObjIsCi(pObj) && Abc_ObjFaninNum(pObj) >= 2) {
+        Lsv_CutManCollect_rec(Abc_ObjFanin0(pObj), vOrder);
+        Lsv_CutManCollect_rec(Abc_ObjFanin1(pObj), vOrder);
+    }
+    Vec_PtrPush(vOrder, pObj);
+}
+
+// Computes the cuts of all nodes and CIs, visiting each object once
+void Lsv_CutManCompute(Lsv_CutMan_t* p) {
+    abctime clk = Abc_Clock();
+    Vec_Ptr_t* vOrder = Vec_PtrAlloc(Abc_NtkObjNumMax(p->pNtk));
+    Abc_Obj_t* pObj;
+    int i;
+    Abc_NtkIncrementTravId(p->pNtk);
+    Abc_NtkForEachObj(p->pNtk, pObj, i)
+        if (Abc_ObjIsNode(pObj) || Abc_ObjIsCi(pObj))
+            Lsv_CutManCollect_rec(pObj, vOrder);
+    Vec_PtrForEachEntry(Abc_Obj_t*, vOrder, pObj, i)
+        if (Lsv_CutManCutNum(p, Abc_ObjId(pObj)) < 0)
+            Lsv_CutManComputeObj(p, pObj);
+    Vec_PtrFree(vOrder);
+    p->timeTotal += Abc_Clock() - clk;
+}
+
+void Lsv_CutManPrintStats(Lsv_CutMan_t* p) {
+    printf("K = %d  Limit = %d  Dom = %s  Cuts = %d  Merged = %d  Filtered = %d  Limited = %d  Mem = %.2f MB  ",
+        p->nLeafMax, p->nCutLimit, p->fDominance ? "yes" : "no", p->nPoolCuts, p->nCutsMerged, p->nCutsFiltered,
+        p->nObjsLimited, 1.0 * sizeof(word) * p->nCutWords * p->nPoolAlloc / (1 << 20));
+    Abc_PrintTime(1, "Time", p->timeTotal);
+}
@@ -0,0 +1,51 @@
+// Memoized k-feasible cut enumeration shared by the LSV commands.
+//
+// Cuts are computed bottom-up in topological order, once per object. All cuts
+// of a manager live in one pool of fixed-size entries (64-bit leaf signature,
+// leaf count, sorted leaf ids), and the cuts of an object form a contiguous
+// range of that pool, so cuts are addressed by index rather than by pointer.
+
+#ifndef LSV_CUT_H
+#define LSV_CUT_H
+
+#include "base/abc/abc.h"
+
+struct Lsv_Cut_t {
+    word uSign;          // signature of the leaves
+    int  nLeaves;        // number of leaves
+    int  pLeaves[0];     // sorted leaf ids (the manager reserves nLeafMax entries)
+};
+
+struct Lsv_CutMan_t {
+    Abc_Ntk_t*  pNtk;        // the network
+    int         nLeafMax;    // the max number of leaves in a cut (k)
+    int         nCutLimit;   // the max number of cuts stored per object (0 = no limit)
+    int         fDominance;  // filter duplicated and dominated cuts
+    int         nCutWords;   // the number of words taken by one pool entry
+    word*       pPool;       // the cut pool
+    int         nPoolCuts;   // the number of cuts in the pool
+    int         nPoolAlloc;  // the number of cuts allocated in the pool
+    Vec_Int_t*  vStart;      // the first cut of each object
+    Vec_Int_t*  vNum;        // the number of cuts of each object (-1 if it has no cuts)
+    // statistics
+    int         nCutsMerged;
+    int         nCutsFiltered;
+    int         nObjsLimited;
+    abctime     timeTotal;
+};
+
+static inline Lsv_Cut_t* Lsv_CutManEntry(Lsv_CutMan_t* p, int iCut)           { return (Lsv_Cut_t*)(p->pPool + (size_t)iCut * p->nCutWords); }
+static inline int        Lsv_CutManCutNum(Lsv_CutMan_t* p, int iObj)           { return Vec_IntEntry(p->vNum, iObj);                         }
+static inline Lsv_Cut_t* Lsv_CutManCut(Lsv_CutMan_t* p, int iObj, int i)       { return Lsv_CutManEntry(p, Vec_IntEntry(p->vStart, iObj) + i); }
+static inline word       Lsv_CutLeafSign(int iLeaf)                            { return ((word)1) << (iLeaf & 63);                           }
+
+// iterates over the cuts of an object (the first one is always the trivial cut)
+#define Lsv_CutManForEachCut(p, iObj, pCut, i) \
+    for (i = 0; i < Lsv_CutManCutNum(p, iObj) && ((pCut) = Lsv_CutManCut(p, iObj, i)); i++)
+
+extern Lsv_CutMan_t* Lsv_CutManStart(Abc_Ntk_t* pNtk, int nLeafMax, int nCutLimit, int fDominance);
+extern void          Lsv_CutManStop(Lsv_CutMan_t* p);
+extern void          Lsv_CutManCompute(Lsv_CutMan_t* p);
+extern void          Lsv_CutManPrintStats(Lsv_CutMan_t* p);
+
+#endif
@@ -0,0 +1,295 @@
+#include "base/abc/abc.h"
+#include "misc/vec/vec.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/cnf/cnf.h"
+#include "aig/aig/aig.h"
+#include "lsv_dc.h"
+
+extern "C" Aig_Man_t* Abc_NtkToDar(Abc_Ntk_t* pNtk, int fExors, int fRegisters);
+
+void Lsv_DcSetDefaultPars(Lsv_DcPars_t* pPars) {
+    memset(pPars, 0, sizeof(Lsv_DcPars_t));
+    pPars->nWords     = 4;
+    pPars->nRounds    = 16;
+    pPars->nConfLimit = 0;
+    pPars->fVerbose   = 0;
+}
+
+static inline word* Lsv_ObjSim(Vec_Wrd_t* vSims, int nWords, Abc_Obj_t* pObj) { return Vec_WrdEntryP(vSims, nWords * Abc_ObjId(pObj)); }
+
+// Simulates the AIG with random patterns and returns, for each object, the mask of fanin patterns
+// observed at it (bit (2 * y0 + y1) is set if the AND gate saw inputs y0 y1). The simulation
+// vectors of one round are shared by all nodes and reused across rounds.
+Vec_Int_t* Lsv_NtkSimObservedPats(Abc_Ntk_t* pNtk, Lsv_DcPars_t* pPars) {
+    int nWords = pPars->nWords;
+    Vec_Ptr_t* vNodes = Abc_AigDfs(pNtk, 1, 0);
+    Vec_Wrd_t* vSims = Vec_WrdStart(nWords * Abc_NtkObjNumMax(pNtk));
+    Vec_Int_t* vPats = Vec_IntStart(Abc_NtkObjNumMax(pNtk));
+    Abc_Obj_t* pObj;
+    word* pSim, * pSim0, * pSim1, c0, c1, y0, y1, u00, u01, u10, u11;
+    int i, r, w, Pats, nFull = 0;
+    assert(Abc_NtkIsStrash(pNtk));
+    pSim = Lsv_ObjSim(vSims, nWords, Abc_AigConst1(pNtk));
+    for (w = 0; w < nWords; w++)
+        pSim[w] = ~(word)0;
+    Abc_RandomW(1);
+    for (r = 0; r < pPars->nRounds && nFull < Vec_PtrSize(vNodes); r++) {
+        Abc_NtkForEachCi(pNtk, pObj, i) {
+            pSim = Lsv_ObjSim(vSims, nWords, pObj);
+            for (w = 0; w < nWords; w++)
+                pSim[w] = Abc_RandomW(0);
+        }
+        Vec_PtrForEachEntry(Abc_Obj_t*, vNodes, pObj, i) {
+            pSim  = Lsv_ObjSim(vSims, nWords, pObj);
+            pSim0 = Lsv_ObjSim(vSims, nWords, Abc_ObjFanin0(pObj));
+            pSim1 = Lsv_ObjSim(vSims, nWords, Abc_ObjFanin1(pObj));
+            c0 = Abc_ObjFaninC0(pObj) ? ~(word)0 : 0;
+            c1 = Abc_ObjFaninC1(pObj) ? ~(word)0 : 0;
+            u00 = u01 = u10 = u11 = 0;
+            for (w = 0; w < nWords; w++) {
+                y0 = pSim0[w] ^ c0;
+                y1 = pSim1[w] ^ c1;
+                pSim[w] = y0 & y1;
+                u00 |= ~y0 & ~y1;
+                u01 |= ~y0 & y1;
+                u10 |= y0 & ~y1;
+                u11 |= y0 & y1;
+            }
+            Pats = Vec_IntEntry(vPats, Abc_ObjId(pObj));
+            if (Pats == 15)
+                continue;
+            Pats |= (u00 ? 1 : 0) | (u01 ? 2 : 0) | (u10 ? 4 : 0) | (u11 ? 8 : 0);
+            Vec_IntWriteEntry(vPats, Abc_ObjId(pObj), Pats);
+            nFull += (Pats == 15);
+        }
+    }
+    if (pPars->fVerbose)
+        printf("Simulated %d rounds of %d patterns. Nodes with all fanin patterns observed = %d (out of %d).\n",
+            r, 64 * nWords, nFull, Vec_PtrSize(vNodes));
+    Vec_WrdFree(vSims);
+    Vec_PtrFree(vNodes);
+    return vPats;
+}
+
+// Computes the SDC masks of the given AND nodes (the result is parallel to vNodes). Patterns
+// observed by simulation are care patterns; each of the remaining ones is checked by one
+// incremental SAT call over the fanin cones of all nodes that have unobserved patterns.
+// Satisfying assignments are recorded as observed patterns of every node, which often
+// spares the SAT calls of the nodes that follow.
+Vec_Int_t* Lsv_NtkComputeSdc(Abc_Ntk_t* pNtk, Vec_Ptr_t* vNodes, Lsv_DcPars_t* pPars) {
+    abctime clk = Abc_Clock();
+    Vec_Int_t* vObserved = Lsv_NtkSimObservedPats(pNtk, pPars);
+    Vec_Int_t* vSdcs = Vec_IntStart(Vec_PtrSize(vNodes));
+    Vec_Int_t* vRootIds = Vec_IntStartFull(Abc_NtkObjNumMax(pNtk));
+    Vec_Ptr_t* vRoots = Vec_PtrAlloc(100);
+    Vec_Int_t* vPending = Vec_IntAlloc(100);
+    Vec_Int_t* vVars = Vec_IntAlloc(100);
+    Abc_Obj_t* pObj, * pFanin;
+    int i, k, j, iPat, Entry, status;
+    int nSatCalls = 0, nSatUnsat = 0, nSatUndec = 0;
+    assert(Abc_NtkIsStrash(pNtk));
+    // collect the fanins of the nodes with unobserved patterns as the roots of the cone
+    Vec_PtrForEachEntry(Abc_Obj_t*, vNodes, pObj, i) {
+        assert(Abc_AigNodeIsAnd(pObj));
+        if (Vec_IntEntry(vObserved, Abc_ObjId(pObj)) == 15)
+            continue;
+        Vec_IntPush(vPending, i);
+        Abc_ObjForEachFanin(pObj, pFanin, k)
+            if (Vec_IntEntry(vRootIds, Abc_ObjId(pFanin)) == -1) {
+                Vec_IntWriteEntry(vRootIds, Abc_ObjId(pFanin), Vec_PtrSize(vRoots));
+                Vec_PtrPush(vRoots, pFanin);
+            }
+    }
+    if (Vec_IntSize(vPending) > 0) {
+        // derive the CNF of the fanin cones once; the CO variables are the root functions
+        Abc_Ntk_t* pCone = Abc_NtkCreateConeArray(pNtk, vRoots, 1);
+        Aig_Man_t* pAig = Abc_NtkToDar(pCone, 0, 0);
+        Cnf_Dat_t* pCnf = Cnf_Derive(pAig, Aig_ManCoNum(pAig));
+        sat_solver* pSat = (sat_solver*)Cnf_DataWriteIntoSolver(pCnf, 1, 0);
+        assert(pSat != NULL);
+        // the SAT variables of the fanins of the pending nodes
+        Vec_IntForEachEntry(vPending, Entry, i) {
+            pObj = (Abc_Obj_t*)Vec_PtrEntry(vNodes, Entry);
+            Abc_ObjForEachFanin(pObj, pFanin, k)
+                Vec_IntPush(vVars, pCnf->pVarNums[Aig_ManCo(pAig, Vec_IntEntry(vRootIds, Abc_ObjId(pFanin)))->Id]);
+        }
+        Vec_IntForEachEntry(vPending, Entry, i) {
+            pObj = (Abc_Obj_t*)Vec_PtrEntry(vNodes, Entry);
+            for (iPat = 0; iPat < 4; iPat++) {
+                lit Lits[2];
+                if ((Vec_IntEntry(vObserved, Abc_ObjId(pObj)) >> iPat) & 1)
+                    continue;
+                Lits[0] = Abc_Var2Lit(Vec_IntEntry(vVars, 2 * i + 0), !(Lsv_DcPatY0(iPat) ^ Abc_ObjFaninC0(pObj)));
+                Lits[1] = Abc_Var2Lit(Vec_IntEntry(vVars, 2 * i + 1), !(Lsv_DcPatY1(iPat) ^ Abc_ObjFaninC1(pObj)));
+                status = sat_solver_solve(pSat, Lits, Lits + 2, (ABC_INT64_T)pPars->nConfLimit, 0, 0, 0);
+                nSatCalls++;
+                if (status == l_False) {
+                    nSatUnsat++;
+                    Vec_IntWriteEntry(vSdcs, Entry, Vec_IntEntry(vSdcs, Entry) | (1 << iPat));
+                    continue;
+                }
+                if (status == l_Undef) {
+                    nSatUndec++;
+                    continue;
+                }
+                // the assignment is a care pattern of this node and possibly of the remaining ones
+                for (j = i; j < Vec_IntSize(vPending); j++) {
+                    Abc_Obj_t* pNode = (Abc_Obj_t*)Vec_PtrEntry(vNodes, Vec_IntEntry(vPending, j));
+                    int y0 = sat_solver_var_value(pSat, Vec_IntEntry(vVars, 2 * j + 0)) ^ Abc_ObjFaninC0(pNode);
+                    int y1 = sat_solver_var_value(pSat, Vec_IntEntry(vVars, 2 * j + 1)) ^ Abc_ObjFaninC1(pNode);
+                    Vec_IntWriteEntry(vObserved, Abc_ObjId(pNode), Vec_IntEntry(vObserved, Abc_ObjId(pNode)) | (1 << Lsv_DcPatIndex(y0, y1)));
+                }
+            }
+        }
+        sat_solver_delete(pSat);
+        Cnf_DataFree(pCnf);
+        Aig_ManStop(pAig);
+        Abc_NtkDelete(pCone);
+    }
+    if (pPars->fVerbose) {
+        printf("Nodes = %d. Pending after simulation = %d. Cone roots = %d. SAT calls = %d (unsat = %d, undecided = %d).  ",
+            Vec_PtrSize(vNodes), Vec_IntSize(vPending), Vec_PtrSize(vRoots), nSatCalls, nSatUnsat, nSatUndec);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+    }
+    Vec_IntFree(vVars);
+    Vec_IntFree(vPending);
+    Vec_PtrFree(vRoots);
+    Vec_IntFree(vRootIds);
+    Vec_IntFree(vObserved);
+    return vSdcs;
+}
+
+// Loads the AIG into a new solver; the variable of each object is its ID
+static sat_solver* Lsv_NtkOdcSolverStart(Abc_Ntk_t* pNtk) {
+    sat_solver* pSat = sat_solver_new();
+    Abc_Obj_t* pObj;
+    int i;
+    sat_solver_setnvars(pSat, Abc_NtkObjNumMax(pNtk));
+    sat_solver_add_const(pSat, Abc_ObjId(Abc_AigConst1(pNtk)), 0);
+    Abc_NtkForEachNode(pNtk, pObj, i)
+        if (Abc_AigNodeIsAnd(pObj))
+            sat_solver_add_and(pSat, Abc_ObjId(pObj), Abc_ObjFaninId0(pObj), Abc_ObjFaninId1(pObj),
+                Abc_ObjFaninC0(pObj), Abc_ObjFaninC1(pObj), 0);
+    return pSat;
+}
+
+// Collects the transitive fanout of the node, including the COs, in a reverse topological order
+static void Lsv_NodeCollectTfo_rec(Abc_Obj_t* pObj, Vec_Ptr_t* vTfo) {
+    Abc_Obj_t* pFanout;
+    int i;
+    if (Abc_NodeIsTravIdCurrent(pObj))
+        return;
+    Abc_NodeSetTravIdCurrent(pObj);
+    // the window ends at the COs, which keeps latches and their outputs out of it
+    if (!Abc_ObjIsCo(pObj))
+        Abc_ObjForEachFanout(pObj, pFanout, i)
+            Lsv_NodeCollectTfo_rec(pFanout, vTfo);
+    Vec_PtrPush(vTfo, pObj);
+}
+
+// Adds the copy of the TFO window of the node in which the node is inverted, and returns the
+// literals of the XORs between the two copies of the affected COs. The window copy is shared
+// with the base copy outside of the TFO, so only the window is encoded for each node.
+static void Lsv_NodeAddOdcWindow(sat_solver* pSat, Abc_Obj_t* pNode, Vec_Ptr_t* vTfo, Vec_Int_t* vLits2, Vec_Int_t* vDiffs) {
+    Abc_Obj_t* pObj;
+    int i, iLit0, iLit1, iVar;
+    Vec_IntClear(vDiffs);
+    Vec_PtrClear(vTfo);
+    Abc_NtkIncrementTravId(Abc_ObjNtk(pNode));
+    Lsv_NodeCollectTfo_rec(pNode, vTfo);
+    Vec_PtrForEachEntryReverse(Abc_Obj_t*, vTfo, pObj, i) {
+        if (pObj == pNode) {
+            Vec_IntWriteEntry(vLits2, Abc_ObjId(pObj), Abc_Var2Lit(Abc_ObjId(pObj), 1));
+            continue;
+        }
+        iLit0 = Vec_IntEntry(vLits2, Abc_ObjFaninId0(pObj));
+        if (iLit0 == -1)
+            iLit0 = Abc_Var2Lit(Abc_ObjFaninId0(pObj), 0);
+        if (Abc_ObjIsCo(pObj)) {
+            // the complemented attributes of the CO are the same in both copies
+            iVar = sat_solver_addvar(pSat);
+            sat_solver_add_xor(pSat, iVar, Abc_ObjFaninId0(pObj), Abc_Lit2Var(iLit0), Abc_LitIsCompl(iLit0));
+            Vec_IntPush(vDiffs, Abc_Var2Lit(iVar, 0));
+            continue;
+        }
+        iLit1 = Vec_IntEntry(vLits2, Abc_ObjFaninId1(pObj));
+        if (iLit1 == -1)
+            iLit1 = Abc_Var2Lit(Abc_ObjFaninId1(pObj), 0);
+        iLit0 = Abc_LitNotCond(iLit0, Abc_ObjFaninC0(pObj));
+        iLit1 = Abc_LitNotCond(iLit1, Abc_ObjFaninC1(pObj));
+        iVar = sat_solver_addvar(pSat);
+        sat_solver_add_and(pSat, iVar, Abc_Lit2Var(iLit0), Abc_Lit2Var(iLit1), Abc_LitIsCompl(iLit0), Abc_LitIsCompl(iLit1), 0);
+        Vec_IntWriteEntry(vLits2, Abc_ObjId(pObj), Abc_Var2Lit(iVar, 0));
+    }
+    Vec_PtrForEachEntry(Abc_Obj_t*, vTfo, pObj, i)
+        Vec_IntWriteEntry(vLits2, Abc_ObjId(pObj), -1);
+}
+
+// Computes the ODC masks of the given AND nodes (the result is parallel to vNodes). The AIG
+// is loaded into one incremental solver once. For each node, only the copy of its TFO window
+// with the node inverted is added, and the care patterns of the fanins are enumerated under an
+// activation literal by blocking each pattern found. The activation literal is then fixed to 0,
+// which retires the node's blocking clauses. SDCs are subtracted at the end, as patterns that
+// never occur are neither care nor observability don't-care patterns.
+Vec_Int_t* Lsv_NtkComputeOdc(Abc_Ntk_t* pNtk, Vec_Ptr_t* vNodes, Lsv_DcPars_t* pPars) {
+    abctime clk = Abc_Clock();
+    Vec_Int_t* vSdcs = Lsv_NtkComputeSdc(pNtk, vNodes, pPars);
+    Vec_Int_t* vOdcs = Vec_IntStart(Vec_PtrSize(vNodes));
+    Vec_Int_t* vLits2 = Vec_IntStartFull(Abc_NtkObjNumMax(pNtk));
+    Vec_Int_t* vDiffs = Vec_IntAlloc(100);
+    Vec_Ptr_t* vTfo = Vec_PtrAlloc(100);
+    sat_solver* pSat = Lsv_NtkOdcSolverStart(pNtk);
+    Abc_Obj_t* pObj;
+    int i, iActVar, status, Care;
+    int nSatCalls = 0, nUndec = 0, nRestarts = 0;
+    assert(Abc_NtkIsStrash(pNtk));
+    Vec_PtrForEachEntry(Abc_Obj_t*, vNodes, pObj, i) {
+        assert(Abc_AigNodeIsAnd(pObj));
+        // recycle the solver when the retired windows outgrow the base copy
+        if (sat_solver_nvars(pSat) > 4 * Abc_NtkObjNumMax(pNtk) + 1000) {
+            sat_solver_delete(pSat);
+            pSat = Lsv_NtkOdcSolverStart(pNtk);
+            nRestarts++;
+        }
+        Lsv_NodeAddOdcWindow(pSat, pObj, vTfo, vLits2, vDiffs);
+        // the miter output is asserted under the activation literal
+        iActVar = sat_solver_addvar(pSat);
+        Vec_IntPush(vDiffs, Abc_Var2Lit(iActVar, 1));
+        sat_solver_addclause(pSat, Vec_IntArray(vDiffs), Vec_IntLimit(vDiffs));
+        for (Care = 0; Care != 15; ) {
+            lit Lits[3];
+            Lits[0] = Abc_Var2Lit(iActVar, 0);
+            status = sat_solver_solve(pSat, Lits, Lits + 1, (ABC_INT64_T)pPars->nConfLimit, 0, 0, 0);
+            nSatCalls++;
+            if (status == l_False)
+                break;
+            if (status == l_Undef) {
+                // treat the patterns not enumerated yet as care patterns
+                nUndec++;
+                Care = 15;
+                break;
+            }
+            int y0 = sat_solver_var_value(pSat, Abc_ObjFaninId0(pObj));
+            int y1 = sat_solver_var_value(pSat, Abc_ObjFaninId1(pObj));
+            Care |= 1 << Lsv_DcPatIndex(y0 ^ Abc_ObjFaninC0(pObj), y1 ^ Abc_ObjFaninC1(pObj));
+            // block this assignment of the fanins
+            Lits[0] = Abc_Var2Lit(iActVar, 1);
+            Lits[1] = Abc_Var2Lit(Abc_ObjFaninId0(pObj), y0);
+            Lits[2] = Abc_Var2Lit(Abc_ObjFaninId1(pObj), y1);
+            sat_solver_addclause(pSat, Lits, Lits + 3);
+        }
+        sat_solver_add_const(pSat, iActVar, 1);
+        Vec_IntWriteEntry(vOdcs, i, 15 & ~Care & ~Vec_IntEntry(vSdcs, i));
+    }
+    if (pPars->fVerbose) {
+        printf("Nodes = %d. SAT calls = %d (undecided = %d). Solver restarts = %d.  ",
+            Vec_PtrSize(vNodes), nSatCalls, nUndec, nRestarts);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+    }
+    sat_solver_delete(pSat);
+    Vec_PtrFree(vTfo);
+    Vec_IntFree(vDiffs);
+    Vec_IntFree(vLits2);
+    Vec_IntFree(vSdcs);
+    return vOdcs;
+}
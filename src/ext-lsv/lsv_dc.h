@@ -0,0 +1,29 @@
+// Simulation- and SAT-based don't-care computation shared by the LSV commands.
+//
+// The local don't-cares of an AND node are kept as 4-bit masks over the values
+// of its two fanin literals (y0, y1): bit (2 * y0 + y1) is set if the pattern
+// "y0 y1" is a don't-care. The fanin values include the complemented
+// attributes of the fanin edges, i.e. they are the inputs of the AND gate.
+
+#ifndef LSV_DC_H
+#define LSV_DC_H
+
+#include "base/abc/abc.h"
+
+struct Lsv_DcPars_t {
+    int nWords;       // the number of simulation words per round
+    int nRounds;      // the number of simulation rounds
+    int nConfLimit;   // the conflict limit per SAT call (0 = no limit)
+    int fVerbose;     // print statistics
+};
+
+static inline int Lsv_DcPatY0(int iPat)        { return iPat >> 1;              }
+static inline int Lsv_DcPatY1(int iPat)        { return iPat & 1;               }
+static inline int Lsv_DcPatIndex(int y0, int y1) { return (y0 << 1) | y1;       }
+
+extern void       Lsv_DcSetDefaultPars(Lsv_DcPars_t* pPars);
+extern Vec_Int_t* Lsv_NtkSimObservedPats(Abc_Ntk_t* pNtk, Lsv_DcPars_t* pPars);
+extern Vec_Int_t* Lsv_NtkComputeSdc(Abc_Ntk_t* pNtk, Vec_Ptr_t* vNodes, Lsv_DcPars_t* pPars);
+extern Vec_Int_t* Lsv_NtkComputeOdc(Abc_Ntk_t* pNtk, Vec_Ptr_t* vNodes, Lsv_DcPars_t* pPars);
+
+#endif
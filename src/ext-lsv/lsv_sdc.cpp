@@ -5,16 +5,13 @@
 #include "sat/bsat/satSolver.h"
 #include "sat/cnf/cnf.h"
 #include "aig/aig/aig.h"
-#include <vector>
-#include <set>
+#include "misc/extra/extra.h"
+#include "lsv_dc.h"
 #include <iostream>
-#include <cassert>
-#include <bitset>
 
 // Prototypes functions
 static int Lsv_CommandSdc(Abc_Frame_t * pAbc, int argc, char ** argv);
 static int Lsv_CommandOdc(Abc_Frame_t * pAbc, int argc, char ** argv);
-extern "C" Aig_Man_t* Abc_NtkToDar(Abc_Ntk_t* pNtk, int fExors, int fRegisters);
 
 void initLsvCommands(Abc_Frame_t* pAbc) {
     Cmd_CommandAdd(pAbc, "Custom", "lsv_sdc", Lsv_CommandSdc, 0);
@@ -22,165 +19,225 @@ void initLsvCommands(Abc_Frame_t* pAbc) {
 }
 void destroy_2(Abc_Frame_t* pAbc) {}
 Abc_FrameInitializer_t frame_initializer_2 = {initLsvCommands, destroy_2};
-struct PackageRegistrationManager {
-    PackageRegistrationManager() { Abc_FrameAddInitializer(&frame_initializer_2); }
+struct PackageRegistrationManager_2 {
+    PackageRegistrationManager_2() { Abc_FrameAddInitializer(&frame_initializer_2); }
 } lsvPackageRegistrationManager_2;
 
-// Helper function: Create a cone for a given node
-static Abc_Ntk_t* createCone(Abc_Ntk_t* pNtk, Abc_Obj_t* pNode) {
-    Vec_Ptr_t* vNodes = Vec_PtrAlloc(1);
-    Vec_PtrPush(vNodes, pNode);
-    Abc_Ntk_t* pCone = Abc_NtkCreateConeArray(pNtk, vNodes, 1);
-    Vec_PtrFree(vNodes);
-    return pCone;
+// Prints the patterns of a mask, one per line
+static void printPatterns(int Mask) {
+    for (int iPat = 0; iPat < 4; ++iPat)
+        if ((Mask >> iPat) & 1)
+            std::cout << Lsv_DcPatY0(iPat) << Lsv_DcPatY1(iPat) << std::endl;
 }
 
 // Part 1: SDC computation
 static int Lsv_CommandSdc(Abc_Frame_t* pAbc, int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Usage: lsv_sdc <node_id>" << std::endl;
-        return 1;
-    }
-
-    Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
-    if (!pNtk) {
-        std::cerr << "No network is loaded." << std::endl;
-        return 1;
-    }
-
-    int nodeId = atoi(argv[1]);
-    Abc_Obj_t* pNode = Abc_NtkObj(pNtk, nodeId);
-    if (!pNode || Abc_ObjIsPi(pNode) || Abc_ObjIsPo(pNode)) {
-        std::cerr << "Invalid node ID. Node must be internal." << std::endl;
-        return 1;
-    }
-
-    // Step 1: Create a cone with the fanins and the target output
-    Vec_Ptr_t* vNodes = Vec_PtrAlloc(3);
-    Vec_PtrPush(vNodes, Abc_ObjFanin0(pNode));
-    Vec_PtrPush(vNodes, Abc_ObjFanin1(pNode));
-    Vec_PtrPush(vNodes, pNode);
-
-    Abc_Ntk_t* pCone = Abc_NtkCreateConeArray(pNtk, vNodes, 1);
-    Vec_PtrFree(vNodes);
-
-    // Cone verification
-    int coneOutputs = Abc_NtkCoNum(pCone);
-    if (coneOutputs == 0) {
-        std::cerr << "Error: Cone has no outputs." << std::endl;
-        Abc_NtkDelete(pCone);
-        return 1;
-    }
-    std::cout << "Cone created with " << coneOutputs << " outputs." << std::endl;
-
-    // Conversion to AIG
-    Aig_Man_t* pAig = Abc_NtkToDar(pCone, 0, 0);
-    if (!pAig) {
-        std::cerr << "Failed to create AIG." << std::endl;
-        Abc_NtkDelete(pCone);
-        return 1;
-    }
-
-    // AIG verification
-    int aigOutputs = Aig_ManCoNum(pAig);
-    if (aigOutputs != coneOutputs) {
-        std::cerr << "Mismatch between AIG outputs and cone outputs." << std::endl;
-        Aig_ManStop(pAig);
-        Abc_NtkDelete(pCone);
-        return 1;
-    }
-    std::cout << "AIG created with " << aigOutputs << " outputs." << std::endl;
-
-    // Step 2: Exhaustive simulation to detect observed assignments
-    std::set<std::string> observedPatterns;
-    for (int val0 = 0; val0 <= 1; ++val0) {
-        for (int val1 = 0; val1 <= 1; ++val1) {
-            std::string pattern = std::to_string(val0) + std::to_string(val1);
-            // Add the observed pattern
-            observedPatterns.insert(pattern);
+    Lsv_DcPars_t Pars, * pPars = &Pars;
+    int c, fAll = 0;
+    Lsv_DcSetDefaultPars(pPars);
+    Extra_UtilGetoptReset();
+    while ((c = Extra_UtilGetopt(argc, argv, "WRCavh")) != EOF) {
+        switch (c) {
+            case 'W':
+            case 'R':
+            case 'C': {
+                if (globalUtilOptind >= argc) {
+                    std::cerr << "Command line switch \"-" << (char)c << "\" should be followed by an integer." << std::endl;
+                    goto usage;
+                }
+                int Value = atoi(argv[globalUtilOptind++]);
+                if (Value < (c == 'C' ? 0 : 1))
+                    goto usage;
+                if (c == 'W') pPars->nWords = Value;
+                if (c == 'R') pPars->nRounds = Value;
+                if (c == 'C') pPars->nConfLimit = Value;
+                break;
+            }
+            case 'a':
+                fAll ^= 1;
+                break;
+            case 'v':
+                pPars->fVerbose ^= 1;
+                break;
+            case 'h':
+            default:
+                goto usage;
         }
     }
+    if (argc != globalUtilOptind + !fAll)
+        goto usage;
+
+    {
+        Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
+        if (!pNtk) {
+            std::cerr << "No network is loaded." << std::endl;
+            return 1;
+        }
+        if (!Abc_NtkIsStrash(pNtk)) {
+            std::cerr << "The network is not an AIG (run \"strash\")." << std::endl;
+            return 1;
+        }
 
-    // Step 3: Detect missing patterns (SDCs)
-    std::vector<std::string> sdcResults;
-    for (int pattern = 0; pattern < 4; ++pattern) {
-        std::string patternStr = std::bitset<2>(pattern).to_string();
-        if (observedPatterns.find(patternStr) == observedPatterns.end()) {
-            // Add the missing pattern as SDC
-            sdcResults.push_back(patternStr);
+        // Step 1: Collect the nodes (one node, or all AND nodes in the batch mode)
+        Vec_Ptr_t* vNodes;
+        if (fAll)
+            vNodes = Abc_AigDfs(pNtk, 1, 0);
+        else {
+            int nodeId = atoi(argv[globalUtilOptind]);
+            Abc_Obj_t* pNode = (nodeId >= 0 && nodeId < Abc_NtkObjNumMax(pNtk)) ? Abc_NtkObj(pNtk, nodeId) : NULL;
+            if (!pNode || !Abc_AigNodeIsAnd(pNode)) {
+                std::cerr << "Invalid node ID. Node must be internal." << std::endl;
+                return 1;
+            }
+            vNodes = Vec_PtrAlloc(1);
+            Vec_PtrPush(vNodes, pNode);
         }
-    }
 
-    // Step 4: Print SDC results
-    if (sdcResults.empty()) {
-        std::cout << "No SDC found." << std::endl;
-    } else {
-        std::cout << "SDCs detected:" << std::endl;
-        for (const auto& result : sdcResults) {
-            std::cout << result << std::endl;
+        // Step 2: Simulate the whole network once, then check the unobserved patterns with SAT
+        Vec_Int_t* vSdcs = Lsv_NtkComputeSdc(pNtk, vNodes, pPars);
+
+        // Step 3: Print SDC results
+        if (!fAll) {
+            if (Vec_IntEntry(vSdcs, 0) == 0)
+                std::cout << "No SDC found." << std::endl;
+            else {
+                std::cout << "SDCs detected:" << std::endl;
+                printPatterns(Vec_IntEntry(vSdcs, 0));
+            }
+        } else {
+            Abc_Obj_t* pNode;
+            int i, nNodesSdc = 0;
+            Vec_PtrForEachEntry(Abc_Obj_t*, vNodes, pNode, i) {
+                int Mask = Vec_IntEntry(vSdcs, i);
+                if (Mask == 0)
+                    continue;
+                std::cout << Abc_ObjId(pNode) << ":";
+                for (int iPat = 0; iPat < 4; ++iPat)
+                    if ((Mask >> iPat) & 1)
+                        std::cout << " " << Lsv_DcPatY0(iPat) << Lsv_DcPatY1(iPat);
+                std::cout << std::endl;
+                nNodesSdc++;
+            }
+            std::cout << "Nodes with SDCs = " << nNodesSdc << " (out of " << Vec_PtrSize(vNodes) << ")." << std::endl;
         }
+        Vec_IntFree(vSdcs);
+        Vec_PtrFree(vNodes);
     }
-
-    // Cleanup
-    Aig_ManStop(pAig);
-    Abc_NtkDelete(pCone);
     return 0;
+
+usage:
+    std::cerr << "Usage: lsv_sdc [-WRC num] [-avh] <node_id>" << std::endl;
+    std::cerr << "\t         computes the satisfiability don't-cares of a node in terms of its fanin values" << std::endl;
+    std::cerr << "\t-W num : the number of 64-bit simulation words per round [default = " << pPars->nWords << "]" << std::endl;
+    std::cerr << "\t-R num : the number of simulation rounds [default = " << pPars->nRounds << "]" << std::endl;
+    std::cerr << "\t-C num : the conflict limit per SAT call (0 = no limit) [default = " << pPars->nConfLimit << "]" << std::endl;
+    std::cerr << "\t-a     : toggle computing SDCs of all AND nodes (no node ID is given) [default = " << (fAll ? "yes" : "no") << "]" << std::endl;
+    std::cerr << "\t-v     : toggle printing statistics [default = " << (pPars->fVerbose ? "yes" : "no") << "]" << std::endl;
+    std::cerr << "\t-h     : print the command usage" << std::endl;
+    return 1;
 }
 
 // Part 2: ODC computation
 static int Lsv_CommandOdc(Abc_Frame_t* pAbc, int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Usage: lsv_odc <node_id>" << std::endl;
-        return 1;
-    }
-
-    Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
-    if (!pNtk) {
-        std::cerr << "No network is loaded." << std::endl;
-        return 1;
-    }
-
-    int nodeId = atoi(argv[1]);
-    Abc_Obj_t* pNode = Abc_NtkObj(pNtk, nodeId);
-    if (!pNode || Abc_ObjIsPi(pNode) || Abc_ObjIsPo(pNode)) {
-        std::cerr << "Invalid node ID. Node must be internal." << std::endl;
-        return 1;
+    Lsv_DcPars_t Pars, * pPars = &Pars;
+    int c, fAll = 0;
+    Lsv_DcSetDefaultPars(pPars);
+    Extra_UtilGetoptReset();
+    while ((c = Extra_UtilGetopt(argc, argv, "WRCavh")) != EOF) {
+        switch (c) {
+            case 'W':
+            case 'R':
+            case 'C': {
+                if (globalUtilOptind >= argc) {
+                    std::cerr << "Command line switch \"-" << (char)c << "\" should be followed by an integer." << std::endl;
+                    goto usage;
+                }
+                int Value = atoi(argv[globalUtilOptind++]);
+                if (Value < (c == 'C' ? 0 : 1))
+                    goto usage;
+                if (c == 'W') pPars->nWords = Value;
+                if (c == 'R') pPars->nRounds = Value;
+                if (c == 'C') pPars->nConfLimit = Value;
+                break;
+            }
+            case 'a':
+                fAll ^= 1;
+                break;
+            case 'v':
+                pPars->fVerbose ^= 1;
+                break;
+            case 'h':
+            default:
+                goto usage;
+        }
     }
-
-    // Step 1: Create a miter between the original and modified circuits
-    Abc_Ntk_t* pMiter = Abc_NtkMiter(pNtk, pNtk, 1, 0, 0, 0);
-    Aig_Man_t* pAig = Abc_NtkToDar(pMiter, 0, 0);
-    Cnf_Dat_t* pCnf = Cnf_Derive(pAig, 1);
-
-    // Step 2: ALLSAT resolution
-    std::vector<std::string> odcResults;
-    while (true) {
-        // SAT logic to find a new ODC assignment
-        bool newAssignmentFound = false; // Replace with SAT logic
-        if (!newAssignmentFound) {
-            break;
+    if (argc != globalUtilOptind + !fAll)
+        goto usage;
+
+    {
+        Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
+        if (!pNtk) {
+            std::cerr << "No network is loaded." << std::endl;
+            return 1;
+        }
+        if (!Abc_NtkIsStrash(pNtk)) {
+            std::cerr << "The network is not an AIG (run \"strash\")." << std::endl;
+            return 1;
         }
 
-        // Filter SDCs to extract ODCs
-        bool isODC = true; // Add logic to check if it is an ODC
-        if (isODC) {
-            odcResults.push_back("xx"); // Replace with actual assignment
+        // Step 1: Collect the nodes (one node, or all AND nodes in the batch mode)
+        Vec_Ptr_t* vNodes;
+        if (fAll)
+            vNodes = Abc_AigDfs(pNtk, 1, 0);
+        else {
+            int nodeId = atoi(argv[globalUtilOptind]);
+            Abc_Obj_t* pNode = (nodeId >= 0 && nodeId < Abc_NtkObjNumMax(pNtk)) ? Abc_NtkObj(pNtk, nodeId) : NULL;
+            if (!pNode || !Abc_AigNodeIsAnd(pNode)) {
+                std::cerr << "Invalid node ID. Node must be internal." << std::endl;
+                return 1;
+            }
+            vNodes = Vec_PtrAlloc(1);
+            Vec_PtrPush(vNodes, pNode);
         }
-    }
 
-    // Step 3: Print ODC results
-    if (odcResults.empty()) {
-        std::cout << "no odc" << std::endl;
-    } else {
-        for (const auto& result : odcResults) {
-            std::cout << result << std::endl;
+        // Step 2: ALLSAT over the TFO window miters in one solver, then subtract the SDCs
+        Vec_Int_t* vOdcs = Lsv_NtkComputeOdc(pNtk, vNodes, pPars);
+
+        // Step 3: Print ODC results
+        if (!fAll) {
+            if (Vec_IntEntry(vOdcs, 0) == 0)
+                std::cout << "no odc" << std::endl;
+            else
+                printPatterns(Vec_IntEntry(vOdcs, 0));
+        } else {
+            Abc_Obj_t* pNode;
+            int i, nNodesOdc = 0;
+            Vec_PtrForEachEntry(Abc_Obj_t*, vNodes, pNode, i) {
+                int Mask = Vec_IntEntry(vOdcs, i);
+                if (Mask == 0)
+                    continue;
+                std::cout << Abc_ObjId(pNode) << ":";
+                for (int iPat = 0; iPat < 4; ++iPat)
+                    if ((Mask >> iPat) & 1)
+                        std::cout << " " << Lsv_DcPatY0(iPat) << Lsv_DcPatY1(iPat);
+                std::cout << std::endl;
+                nNodesOdc++;
+            }
+            std::cout << "Nodes with ODCs = " << nNodesOdc << " (out of " << Vec_PtrSize(vNodes) << ")." << std::endl;
         }
+        Vec_IntFree(vOdcs);
+        Vec_PtrFree(vNodes);
     }
-
-    // Cleanup
-    Cnf_DataFree(pCnf);
-    Aig_ManStop(pAig);
-    Abc_NtkDelete(pMiter);
     return 0;
+
+usage:
+    std::cerr << "Usage: lsv_odc [-WRC num] [-avh] <node_id>" << std::endl;
+    std::cerr << "\t         computes the observability don't-cares of a node in terms of its fanin values" << std::endl;
+    std::cerr << "\t-W num : the number of 64-bit simulation words per round [default = " << pPars->nWords << "]" << std::endl;
+    std::cerr << "\t-R num : the number of simulation rounds [default = " << pPars->nRounds << "]" << std::endl;
+    std::cerr << "\t-C num : the conflict limit per SAT call (0 = no limit) [default = " << pPars->nConfLimit << "]" << std::endl;
+    std::cerr << "\t-a     : toggle computing ODCs of all AND nodes (no node ID is given) [default = " << (fAll ? "yes" : "no") << "]" << std::endl;
+    std::cerr << "\t-v     : toggle printing statistics [default = " << (pPars->fVerbose ? "yes" : "no") << "]" << std::endl;
+    std::cerr << "\t-h     : print the command usage" << std::endl;
+    return 1;
 }
- 
\ No newline at end of file
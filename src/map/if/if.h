@@ -114,6 +114,7 @@ struct If_Par_t_
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
     int                nLutDecSize;   // the LUT size for decomposition
+    int                nProcs;        // the number of threads for wavefront mapping (0 = sequential)
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -152,6 +153,7 @@ struct If_Par_t_
     int                fVerbose;      // the verbosity flag
     int                fVerboseTrace; // the verbosity flag
     char *             pLutStruct;    // LUT structure
+    char *             pCacheFile;    // the file storing the results of the cell checks
     int                fEnableStructN;// LUT structure using a new method
     float              WireDelay;     // wire delay
     // internal parameters
@@ -227,6 +229,7 @@ struct If_Man_t_
     unsigned           uSharedMask;   // mask of shared variables
     int                nShared;       // the number of shared variables
     int                fReqTimeWarn;  // warning about exceeding required times was printed
+    int                fWaveCopy;     // this is a worker copy; cutsets and refs are handled by the caller
     // SOP balancing
     Vec_Int_t *        vCover;        // used to compute ISOP
     Vec_Int_t *        vArray;        // intermediate storage
@@ -273,6 +276,11 @@ struct If_Man_t_
     unsigned           uCanonPhase;
     int                nCacheHits;
     int                nCacheMisses;
+    Vec_Mem_t *        vCellMem[IF_MAX_FUNC_LUTSIZE+1]; // cut functions with known results of the cell check
+    Vec_Str_t *        vCellRes[IF_MAX_FUNC_LUTSIZE+1]; // the results of the cell check for these functions
+    int                nCellLoaded;   // the number of cell check results loaded from file
+    int                nCellHits;     // the number of cell checks found in the cache
+    int                nCellMisses;   // the number of cell checks performed
     abctime            timeCache[6];
     int                nBestCutSmall[2];
     int                nCountNonDec[2];
@@ -514,6 +522,10 @@ static inline float      If_CutLutDelay( If_LibLut_t * p, int Size, int iPin )
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== ifCache.c ==========================================================*/
+extern void            If_ManCellCacheStart( If_Man_t * p );
+extern int             If_ManCellCacheCheck( If_Man_t * p, If_Cut_t * pCut );
+extern void            If_ManCellCacheStop( If_Man_t * p );
 /*=== ifCore.c ===========================================================*/
 extern void            If_ManSetDefaultPars( If_Par_t * pPars );
 extern int             If_ManPerformMapping( If_Man_t * p );
@@ -655,6 +667,10 @@ extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+/*=== ifMapPar.c ==========================================================*/
+extern int             If_ManWaveMappingCheck( If_Man_t * p );
+extern int             If_ManCrossCutWave( If_Man_t * p );
+extern void            If_ManPerformMappingWaves( If_Man_t * p, int Mode, int fPreprocess, int fFirst, char * pLabel );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
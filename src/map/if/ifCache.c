@@ -27,6 +27,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define IF_CACHE_VERSION "ifc1"
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -91,6 +93,202 @@ void If_ManCacheAnalize( If_Man_t * p )
     Vec_IntFree( vRes );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the string identifying the cell check.]
+
+  Description [The results stored in the cache file are reused only if
+  the mapping parameters that select the cell check are the same.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManCellCacheKey( If_Man_t * p, char * pBuffer )
+{
+    If_Par_t * pPars = p->pPars;
+    sprintf( pBuffer, "K%d S%s N%d M%d C%d%d%d%d%d%d", pPars->nLutSize, 
+        pPars->pLutStruct ? pPars->pLutStruct : "-", pPars->fEnableStructN, pPars->fCutMin, 
+        pPars->fEnableCheck07, pPars->fEnableCheck75, pPars->fEnableCheck75u, 
+        pPars->fUseCheck1, pPars->fUseCheck2, pPars->fUseBat );
+}
+static void If_ManCellCacheAlloc( If_Man_t * p )
+{
+    int v;
+    for ( v = 0; v <= p->pPars->nLutSize; v++ )
+    {
+        p->vCellMem[v] = Vec_MemAlloc( p->nTruth6Words[v], 12 );
+        Vec_MemHashAlloc( p->vCellMem[v], 10000 );
+        p->vCellRes[v] = Vec_StrAlloc( 1000 );
+    }
+    p->nCellLoaded = 0;
+}
+static void If_ManCellCacheFree( If_Man_t * p )
+{
+    int v;
+    for ( v = 0; v <= p->pPars->nLutSize; v++ )
+    {
+        Vec_MemHashFree( p->vCellMem[v] );
+        Vec_MemFreeP( &p->vCellMem[v] );
+        Vec_StrFreeP( &p->vCellRes[v] );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the cache of the cell check results.]
+
+  Description [Loads the results computed by the previous runs, if the
+  cache file exists and was created for the same cell check.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCellCacheStart( If_Man_t * p )
+{
+    char pKey[1000], pBuffer[1000];
+    word * pTruth;
+    FILE * pFile;
+    int v, i, Num, fError = 0;
+    assert( p->vCellMem[0] == NULL );
+    if ( p->pPars->pCacheFile == NULL )
+        return;
+    if ( !p->pPars->fTruth || p->pPars->pFuncCell == NULL )
+    {
+        Abc_Print( 0, "The cache file \"%s\" is not used because there is no cell check.\n", p->pPars->pCacheFile );
+        return;
+    }
+    If_ManCellCacheAlloc( p );
+    pFile = fopen( p->pPars->pCacheFile, "rb" );
+    if ( pFile == NULL ) // the file will be created
+        return;
+    If_ManCellCacheKey( p, pKey );
+    if ( fread( pBuffer, 4, 1, pFile ) != 1 || strncmp(pBuffer, IF_CACHE_VERSION, 4) )
+    {
+        Abc_Print( 0, "Unrecognized format of the cache file \"%s\".\n", p->pPars->pCacheFile );
+        fclose( pFile );
+        return;
+    }
+    if ( fread( &Num, 4, 1, pFile ) != 1 || Num <= 0 || Num >= 1000 || fread( pBuffer, Num, 1, pFile ) != 1 )
+        Num = 0;
+    pBuffer[Num] = 0;
+    if ( strcmp(pBuffer, pKey) )
+    {
+        Abc_Print( 0, "The cache file \"%s\" was created for a different cell check and will be overwritten.\n", p->pPars->pCacheFile );
+        fclose( pFile );
+        return;
+    }
+    pTruth = ABC_ALLOC( word, p->nTruth6Words[p->pPars->nLutSize] );
+    for ( v = 0; !fError && v <= p->pPars->nLutSize; v++ )
+    {
+        if ( fread( &Num, 4, 1, pFile ) != 1 || Num < 0 )
+        {
+            fError = 1;
+            break;
+        }
+        for ( i = 0; i < Num; i++ )
+            if ( fread( pTruth, sizeof(word) * p->nTruth6Words[v], 1, pFile ) != 1 || Vec_MemHashInsert(p->vCellMem[v], pTruth) != i )
+            {
+                fError = 1;
+                break;
+            }
+        Vec_StrFill( p->vCellRes[v], Num, 0 );
+        if ( !fError && Num > 0 && fread( Vec_StrArray(p->vCellRes[v]), Num, 1, pFile ) != 1 )
+            fError = 1;
+        p->nCellLoaded += Num;
+    }
+    ABC_FREE( pTruth );
+    fclose( pFile );
+    if ( fError )
+    {
+        Abc_Print( 0, "The cache file \"%s\" is corrupted and will be overwritten.\n", p->pPars->pCacheFile );
+        If_ManCellCacheFree( p );
+        If_ManCellCacheAlloc( p );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the cell check of the cut function using the cache.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCellCacheCheck( If_Man_t * p, If_Cut_t * pCut )
+{
+    word * pTruth = If_CutTruthW( p, pCut );
+    int nLeaves = pCut->nLeaves, Id, Value;
+    if ( p->vCellMem[0] == NULL )
+        return p->pPars->pFuncCell( p, (unsigned *)pTruth, Abc_MaxInt(6, nLeaves), nLeaves, p->pPars->pLutStruct );
+    Id = Vec_MemHashInsert( p->vCellMem[nLeaves], pTruth );
+    if ( Id < Vec_StrSize(p->vCellRes[nLeaves]) )
+    {
+        p->nCellHits++;
+        return (int)Vec_StrEntry( p->vCellRes[nLeaves], Id );
+    }
+    p->nCellMisses++;
+    Value = p->pPars->pFuncCell( p, (unsigned *)pTruth, Abc_MaxInt(6, nLeaves), nLeaves, p->pPars->pLutStruct );
+    Vec_StrPush( p->vCellRes[nLeaves], (char)(Value != 0) );
+    assert( Id == Vec_StrSize(p->vCellRes[nLeaves]) - 1 );
+    return Value;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the cache of the cell check results and stops it.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManCellCacheStop( If_Man_t * p )
+{
+    char pKey[1000];
+    word * pTruth;
+    FILE * pFile;
+    int v, i, Num;
+    long FileSize = 0;
+    if ( p->vCellMem[0] == NULL )
+        return;
+    pFile = fopen( p->pPars->pCacheFile, "wb" );
+    if ( pFile == NULL )
+        Abc_Print( 0, "Writing the cache file \"%s\" has failed.\n", p->pPars->pCacheFile );
+    else
+    {
+        If_ManCellCacheKey( p, pKey );
+        fwrite( IF_CACHE_VERSION, 4, 1, pFile );
+        Num = strlen(pKey);
+        fwrite( &Num, 4, 1, pFile );
+        fwrite( pKey, Num, 1, pFile );
+        for ( v = 0; v <= p->pPars->nLutSize; v++ )
+        {
+            Num = Vec_StrSize(p->vCellRes[v]);
+            assert( Num == Vec_MemEntryNum(p->vCellMem[v]) );
+            fwrite( &Num, 4, 1, pFile );
+            Vec_MemForEachEntry( p->vCellMem[v], pTruth, i )
+                fwrite( pTruth, sizeof(word) * p->nTruth6Words[v], 1, pFile );
+            if ( Num > 0 )
+                fwrite( Vec_StrArray(p->vCellRes[v]), Num, 1, pFile );
+        }
+        FileSize = ftell( pFile );
+        fclose( pFile );
+    }
+    Abc_Print( 1, "Cell check cache \"%s\":  Loaded = %d.  Added = %d.  Hits = %d (%.2f %%).  File = %.2f MB.\n", 
+        p->pPars->pCacheFile, p->nCellLoaded, p->nCellMisses, p->nCellHits, 
+        100.0 * p->nCellHits / Abc_MaxInt(1, p->nCellHits + p->nCellMisses), 1.0 * FileSize / (1<<20) );
+    If_ManCellCacheFree( p );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -81,14 +81,23 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
 ***********************************************************************/
 int If_ManPerformMapping( If_Man_t * p )
 {
+    int RetValue;
     p->pPars->fAreaOnly = p->pPars->fArea; // temporary
+    // load the results of the cell checks
+    If_ManCellCacheStart( p );
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
     // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    if ( p->pPars->nProcs > 0 && If_ManWaveMappingCheck(p) )
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutWave(p)) );
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
-    return If_ManPerformMappingComb( p );
+    RetValue = If_ManPerformMappingComb( p );
+    // save the results of the cell checks
+    If_ManCellCacheStop( p );
+    return RetValue;
 }
 
 
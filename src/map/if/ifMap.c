@@ -182,7 +182,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
     // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
+    pCutSet = p->fWaveCopy ? pObj->pCutSet : If_ManSetupNodeCutSet( p, pObj );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -329,7 +329,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 else if ( p->pPars->pFuncCell2 )
                     pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
                 else
-                    pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
+                    pCut->fUseless = !If_ManCellCacheCheck( p, pCut );
                 p->nCutsUselessAll += pCut->fUseless;
                 p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
                 p->nCutsCountAll++;
@@ -494,11 +494,14 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //    else if ( If_ObjCutBest(pObj)->nLeaves == 1 )
 //        p->nBestCutSmall[1]++;
 
+    if ( If_ObjCutBest(pObj)->fUseless )
+        Abc_Print( 1, "The best cut is useless.\n" );
+    // the rest is done by the caller in the wavefront mode
+    if ( p->fWaveCopy )
+        return;
     // ref the selected cut
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
-    if ( If_ObjCutBest(pObj)->fUseless )
-        Abc_Print( 1, "The best cut is useless.\n" );
     // call the user specified function for each cut
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
@@ -658,6 +661,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( p->pPars->nProcs > 0 && Mode == 0 && If_ManWaveMappingCheck(p) )
+        If_ManPerformMappingWaves( p, Mode, fPreprocess, fFirst, pLabel );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
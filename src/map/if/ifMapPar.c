@@ -0,0 +1,335 @@
+/**CFile****************************************************************
+
+  FileName    [ifMapPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [FPGA mapping based on priority cuts.]
+
+  Synopsis    [Multi-threaded mapping on level wavefronts.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "if.h"
+#include "misc/extra/extra.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+#include <atomic>
+using namespace std;
+#else
+#include <stdatomic.h>
+#include <stdbool.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The AND nodes on the same logic level do not depend on each other,
+// so their cuts can be computed concurrently once the previous levels
+// are done. Each thread maps a contiguous range of the wavefront using
+// a private copy of the manager (for the statistics), while the cutsets
+// are allocated and released by the main thread. Only the delay-oriented
+// passes are mapped this way: they do not change the reference counters,
+// so the cuts of a node depend only on the cuts of its fanins, and the
+// mapping is the same as in the node order for any number of threads.
+// The area-flow and the exact-area passes dereference and reference the
+// best cuts, so the cost of a node depends on all nodes mapped before it;
+// they are always performed in the node order.
+
+#define IF_PAR_THR_MAX   100   // the largest number of threads
+#define IF_PAR_NODE_MIN   64   // the smallest number of nodes given to a thread
+
+typedef struct If_ThData_t_ If_ThData_t;
+struct If_ThData_t_
+{
+    If_Man_t *   p;            // the copy of the manager
+    If_Obj_t **  ppNodes;      // the first node to map (NULL to stop the thread)
+    int          nNodes;       // the number of nodes to map
+    int          Mode;         // the mapping mode
+    int          fPreprocess;  // preprocessing
+    int          fFirst;       // the first round
+#ifdef ABC_USE_PTHREADS
+    atomic_bool  fWorking;     // the thread is busy
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping can be performed on wavefronts.]
+
+  Description [Truth tables are not supported because the truth table
+  hash tables assign function IDs in the order of computation. User
+  functions, timing boxes, choices, and special delay models are not
+  supported because they rely on the shared state of the manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManWaveMappingCheck( If_Man_t * p )
+{
+    If_Par_t * pPars = p->pPars;
+    if ( p->pManTim || p->nChoices || pPars->fLiftLeaves )
+        return 0;
+    if ( pPars->fTruth || pPars->pFuncCost || pPars->pFuncUser || pPars->fPower )
+        return 0;
+    if ( pPars->pLutLib && pPars->pLutLib->fVarPinDelays )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib ||
+         pPars->fUserLutDec || pPars->fUserLut2D || pPars->nGateSize > 0 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the AND nodes in the order of their levels.]
+
+  Description [Returns the nodes sorted by level and, within a level,
+  by ID. The entries of vStarts point to the first node of each level.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * If_ManCollectWaves( If_Man_t * p, Vec_Int_t * vStarts )
+{
+    Vec_Ptr_t * vNodes;
+    If_Obj_t * pObj;
+    int i, Level, nLevels = p->nLevelMax + 2;
+    Vec_IntFill( vStarts, nLevels, 0 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_IntAddToEntry( vStarts, pObj->Level + 1, 1 );
+    for ( Level = 1; Level < nLevels; Level++ )
+        Vec_IntAddToEntry( vStarts, Level, Vec_IntEntry(vStarts, Level-1) );
+    vNodes = Vec_PtrStart( If_ManAndNum(p) );
+    If_ManForEachNode( p, pObj, i )
+    {
+        Level = pObj->Level;
+        Vec_PtrWriteEntry( vNodes, Vec_IntEntry(vStarts, Level), pObj );
+        Vec_IntAddToEntry( vStarts, Level, 1 );
+    }
+    // shift the starts back
+    for ( Level = nLevels - 1; Level > 0; Level-- )
+        Vec_IntWriteEntry( vStarts, Level, Vec_IntEntry(vStarts, Level-1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    assert( Vec_IntEntryLast(vStarts) == If_ManAndNum(p) );
+    return vNodes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit when mapping by levels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutWave( If_Man_t * p )
+{
+    Vec_Int_t * vStarts = Vec_IntAlloc( p->nLevelMax + 2 );
+    Vec_Ptr_t * vNodes = If_ManCollectWaves( p, vStarts );
+    If_Obj_t * pObj, * pFanin;
+    int i, k, nCutSize = 0, nCutSizeMax = 0;
+    for ( i = 0; i + 1 < Vec_IntSize(vStarts); i++ )
+    {
+        // all cutsets of the level are allocated at the same time
+        nCutSize += Vec_IntEntry(vStarts, i+1) - Vec_IntEntry(vStarts, i);
+        nCutSizeMax = Abc_MaxInt( nCutSizeMax, nCutSize );
+        for ( k = Vec_IntEntry(vStarts, i); k < Vec_IntEntry(vStarts, i+1); k++ )
+        {
+            pObj = (If_Obj_t *)Vec_PtrEntry( vNodes, k );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vStarts );
+    return nCutSizeMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps a range of nodes of one wavefront.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void If_ManMapWaveRange( If_ThData_t * pThData )
+{
+    int i;
+    for ( i = 0; i < pThData->nNodes; i++ )
+        If_ObjPerformMappingAnd( pThData->p, pThData->ppNodes[i], pThData->Mode, pThData->fPreprocess, pThData->fFirst );
+}
+
+#ifdef ABC_USE_PTHREADS
+void * If_ManMapWaveThread( void * pArg )
+{
+    If_ThData_t * pThData = (If_ThData_t *)pArg;
+    while ( 1 )
+    {
+        while ( !atomic_load_explicit((atomic_bool *)&pThData->fWorking, memory_order_acquire) );
+        if ( pThData->ppNodes == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        If_ManMapWaveRange( pThData );
+        atomic_store_explicit(&pThData->fWorking, false, memory_order_release);
+    }
+    assert( 0 );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over all nodes by wavefronts.]
+
+  Description [Supports only the delay mode (0).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingWaves( If_Man_t * p, int Mode, int fPreprocess, int fFirst, char * pLabel )
+{
+    ProgressBar * pProgress;
+    If_ThData_t ThData[IF_PAR_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[IF_PAR_THR_MAX];
+    int status;
+#endif
+    Vec_Int_t * vStarts = Vec_IntAlloc( p->nLevelMax + 2 );
+    Vec_Ptr_t * vNodes = If_ManCollectWaves( p, vStarts );
+    If_Obj_t ** ppNodes = (If_Obj_t **)Vec_PtrArray( vNodes );
+    int i, k, t, iBeg, iEnd, nThreads, nUsed;
+    assert( Mode == 0 );
+    assert( If_ManWaveMappingCheck(p) );
+    nThreads = Abc_MinInt( p->pPars->nProcs, IF_PAR_THR_MAX );
+#ifndef ABC_USE_PTHREADS
+    nThreads = 1;
+#endif
+    // the threads use the copies of the manager to collect their statistics
+    for ( t = 0; t < nThreads; t++ )
+    {
+        ThData[t].p = ABC_ALLOC( If_Man_t, 1 );
+        memcpy( ThData[t].p, p, sizeof(If_Man_t) );
+        ThData[t].p->fWaveCopy   = 1;
+        ThData[t].p->nCutsMerged = 0;
+        ThData[t].p->nCutsTotal  = 0;
+        ThData[t].ppNodes        = NULL;
+        ThData[t].nNodes         = 0;
+        ThData[t].Mode           = Mode;
+        ThData[t].fPreprocess    = fPreprocess;
+        ThData[t].fFirst         = fFirst;
+    }
+#ifdef ABC_USE_PTHREADS
+    fflush( stdout );
+    // the main thread maps the first range of each wavefront
+    for ( t = 1; t < nThreads; t++ )
+    {
+        atomic_store_explicit(&ThData[t].fWorking, false, memory_order_release);
+        status = pthread_create( WorkerThread + t, NULL, If_ManMapWaveThread, (void *)(ThData + t) );  assert( status == 0 );
+    }
+#endif
+    pProgress = Extra_ProgressBarStart( stdout, If_ManAndNum(p) );
+    for ( i = 0; i + 1 < Vec_IntSize(vStarts); i++ )
+    {
+        iBeg = Vec_IntEntry( vStarts, i );
+        iEnd = Vec_IntEntry( vStarts, i+1 );
+        if ( iBeg == iEnd )
+            continue;
+        Extra_ProgressBarUpdate( pProgress, iBeg, pLabel );
+        // prepare the cutsets
+        for ( k = iBeg; k < iEnd; k++ )
+            If_ManSetupNodeCutSet( p, ppNodes[k] );
+        // split the wavefront among the threads
+        nUsed = Abc_MaxInt( 1, Abc_MinInt(nThreads, (iEnd - iBeg) / IF_PAR_NODE_MIN) );
+        for ( t = 0; t < nUsed; t++ )
+        {
+            ThData[t].ppNodes = ppNodes + iBeg + (int)((word)(iEnd - iBeg) * t / nUsed);
+            ThData[t].nNodes  = (int)((word)(iEnd - iBeg) * (t + 1) / nUsed) - (int)((word)(iEnd - iBeg) * t / nUsed);
+        }
+#ifdef ABC_USE_PTHREADS
+        for ( t = 1; t < nUsed; t++ )
+            atomic_store_explicit(&ThData[t].fWorking, true, memory_order_release);
+#endif
+        If_ManMapWaveRange( ThData );
+#ifdef ABC_USE_PTHREADS
+        for ( t = 1; t < nUsed; t++ )
+            while ( atomic_load_explicit(&ThData[t].fWorking, memory_order_acquire) );
+#endif
+        // release the cutsets of the fanins
+        for ( k = iBeg; k < iEnd; k++ )
+            If_ManDerefNodeCutSet( p, ppNodes[k] );
+    }
+    Extra_ProgressBarStop( pProgress );
+#ifdef ABC_USE_PTHREADS
+    // stop the threads
+    for ( t = 1; t < nThreads; t++ )
+    {
+        ThData[t].ppNodes = NULL;
+        atomic_store_explicit(&ThData[t].fWorking, true, memory_order_release);
+    }
+    for ( t = 1; t < nThreads; t++ )
+        pthread_join( WorkerThread[t], NULL );
+#endif
+    // collect the statistics
+    for ( t = 0; t < nThreads; t++ )
+    {
+        p->nCutsMerged += ThData[t].p->nCutsMerged;
+        p->nCutsTotal  += ThData[t].p->nCutsTotal;
+        ABC_FREE( ThData[t].p );
+    }
+    Vec_PtrFree( vNodes );
+    Vec_IntFree( vStarts );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
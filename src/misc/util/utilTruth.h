@@ -136,6 +136,23 @@ static word s_PPMasks[5][6][3] = {
 
 static inline int Abc_TtBitCount16( int i ) { return __builtin_popcount( i & 0xffff ); }
 
+// kernels of the multi-word operations (utilTruthSimd.c) used for the
+// tables with at least ABC_TT_SIMD_WORDS_MIN words; Abc_TtSimdStart()
+// selects the vectorized ones once according to the CPU features
+#define ABC_TT_SIMD_WORDS_MIN  8
+extern void (*Abc_TtSimdAnd)( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl );
+extern void (*Abc_TtSimdAndCompl)( word * pOut, word * pIn1, int fCompl1, word * pIn2, int fCompl2, int nWords );
+extern void (*Abc_TtSimdOr)( word * pOut, word * pIn1, word * pIn2, int nWords );
+extern void (*Abc_TtSimdSharp)( word * pOut, word * pIn1, word * pIn2, int nWords );
+extern void (*Abc_TtSimdXor)( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl );
+extern int  (*Abc_TtSimdEqual)( word * pIn1, word * pIn2, int nWords );
+extern int  (*Abc_TtSimdIsConst0)( word * pIn1, int nWords );
+extern int  (*Abc_TtSimdCountOnes)( word * pIn1, int nWords );
+extern void (*Abc_TtSimdSwap)( word * pIn1, word * pIn2, int nWords );
+extern void   Abc_TtSimdStart();
+extern const char * Abc_TtSimdName();
+extern void   Abc_TtSimdBench( int nVarsMin, int nVarsMax, int nWordsTotal, int fVerbose );
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -318,7 +335,9 @@ static inline word * Abc_TtDup( word * pIn, int nWords, int fCompl )
 static inline void Abc_TtAnd( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
 {
     int w;
-    if ( fCompl )
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        Abc_TtSimdAnd( pOut, pIn1, pIn2, nWords, fCompl );
+    else if ( fCompl )
         for ( w = 0; w < nWords; w++ )
             pOut[w] = ~(pIn1[w] & pIn2[w]);
     else
@@ -328,7 +347,9 @@ static inline void Abc_TtAnd( word * pOut, word * pIn1, word * pIn2, int nWords,
 static inline void Abc_TtAndCompl( word * pOut, word * pIn1, int fCompl1, word * pIn2, int fCompl2, int nWords )
 {
     int w;
-    if ( fCompl1 )
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        Abc_TtSimdAndCompl( pOut, pIn1, fCompl1, pIn2, fCompl2, nWords );
+    else if ( fCompl1 )
     {
         if ( fCompl2 )
             for ( w = 0; w < nWords; w++ )
@@ -360,12 +381,18 @@ static inline void Abc_TtAndSharp( word * pOut, word * pIn1, word * pIn2, int nW
 static inline void Abc_TtSharp( word * pOut, word * pIn1, word * pIn2, int nWords )
 {
     int w;
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        Abc_TtSimdSharp( pOut, pIn1, pIn2, nWords );
+    else
     for ( w = 0; w < nWords; w++ )
         pOut[w] = pIn1[w] & ~pIn2[w];
 }
 static inline void Abc_TtOr( word * pOut, word * pIn1, word * pIn2, int nWords )
 {
     int w;
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        Abc_TtSimdOr( pOut, pIn1, pIn2, nWords );
+    else
     for ( w = 0; w < nWords; w++ )
         pOut[w] = pIn1[w] | pIn2[w];
 }
@@ -396,7 +423,9 @@ static inline void Abc_TtSharpOr( word * pOut, word * pIn1, word * pIn2, int nWo
 static inline void Abc_TtXor( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
 {
     int w;
-    if ( fCompl )
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        Abc_TtSimdXor( pOut, pIn1, pIn2, nWords, fCompl );
+    else if ( fCompl )
         for ( w = 0; w < nWords; w++ )
             pOut[w] = pIn1[w] ^ ~pIn2[w];
     else
@@ -596,6 +625,8 @@ static inline int Abc_TtIntersectXor( word * pOut, int fComp, word * pIn0, word
 static inline int Abc_TtEqual( word * pIn1, word * pIn2, int nWords )
 {
     int w;
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        return Abc_TtSimdEqual( pIn1, pIn2, nWords );
     for ( w = 0; w < nWords; w++ )
         if ( pIn1[w] != pIn2[w] )
             return 0;
@@ -653,6 +684,8 @@ static inline int Abc_TtCompareRev( word * pIn1, word * pIn2, int nWords )
 static inline int Abc_TtIsConst0( word * pIn1, int nWords )
 {
     int w;
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        return Abc_TtSimdIsConst0( pIn1, nWords );
     for ( w = 0; w < nWords; w++ )
         if ( pIn1[w] )
             return 0;
@@ -1083,6 +1116,10 @@ static inline void Abc_TtCofactor0( word * pTruth, int nWords, int iVar )
     {
         word * pLimit = pTruth + nWords;
         int i, iStep = Abc_TtWordNum(iVar);
+        if ( iStep >= ABC_TT_SIMD_WORDS_MIN )
+            for ( ; pTruth < pLimit; pTruth += 2*iStep )
+                memcpy( pTruth + iStep, pTruth, sizeof(word) * iStep );
+        else
         for ( ; pTruth < pLimit; pTruth += 2*iStep )
             for ( i = 0; i < iStep; i++ )
                 pTruth[i + iStep] = pTruth[i];
@@ -1102,6 +1139,10 @@ static inline void Abc_TtCofactor1( word * pTruth, int nWords, int iVar )
     {
         word * pLimit = pTruth + nWords;
         int i, iStep = Abc_TtWordNum(iVar);
+        if ( iStep >= ABC_TT_SIMD_WORDS_MIN )
+            for ( ; pTruth < pLimit; pTruth += 2*iStep )
+                memcpy( pTruth, pTruth + iStep, sizeof(word) * iStep );
+        else
         for ( ; pTruth < pLimit; pTruth += 2*iStep )
             for ( i = 0; i < iStep; i++ )
                 pTruth[i] = pTruth[i + iStep];
@@ -1908,6 +1949,10 @@ static inline void Abc_TtSwapAdjacent( word * pTruth, int nWords, int iVar )
     {
         word * pLimit = pTruth + nWords;
         int i, iStep = Abc_TtWordNum(iVar);
+        if ( iStep >= ABC_TT_SIMD_WORDS_MIN )
+            for ( ; pTruth < pLimit; pTruth += 4*iStep )
+                Abc_TtSimdSwap( pTruth + iStep, pTruth + 2*iStep, iStep );
+        else
         for ( ; pTruth < pLimit; pTruth += 4*iStep )
             for ( i = 0; i < iStep; i++ )
                 ABC_SWAP( word, pTruth[i + iStep], pTruth[i + 2*iStep] );
@@ -1961,6 +2006,11 @@ static inline void Abc_TtSwapVars( word * pTruth, int nVars, int iVar, int jVar
         word * pLimit = pTruth + Abc_TtWordNum(nVars);
         int i, iStep = Abc_TtWordNum(iVar);
         int j, jStep = Abc_TtWordNum(jVar);
+        if ( iStep >= ABC_TT_SIMD_WORDS_MIN )
+            for ( ; pTruth < pLimit; pTruth += 2*jStep )
+                for ( i = 0; i < jStep; i += 2*iStep )
+                    Abc_TtSimdSwap( pTruth + iStep + i, pTruth + jStep + i, iStep );
+        else
         for ( ; pTruth < pLimit; pTruth += 2*jStep )
             for ( i = 0; i < jStep; i += 2*iStep )
                 for ( j = 0; j < iStep; j++ )
@@ -2279,6 +2329,8 @@ static inline int Abc_TtCountOnes2( word x )
 static inline int Abc_TtCountOnesVec( word * x, int nWords )
 {
     int w, Count = 0;
+    if ( nWords >= ABC_TT_SIMD_WORDS_MIN )
+        return Abc_TtSimdCountOnes( x, nWords );
     for ( w = 0; w < nWords; w++ )
         Count += Abc_TtCountOnes2( x[w] );
     return Count;
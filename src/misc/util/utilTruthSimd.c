@@ -0,0 +1,582 @@
+/**CFile****************************************************************
+
+  FileName    [utilTruthSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Truth table manipulation.]
+
+  Synopsis    [Vectorized kernels of the multi-word truth table operations.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "misc/util/abc_global.h"
+#include "misc/util/utilTruth.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_TT_NO_SIMD)
+#define ABC_TT_USE_SIMD
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+static void Abc_TtScalarAnd( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl );
+static void Abc_TtScalarAndCompl( word * pOut, word * pIn1, int fCompl1, word * pIn2, int fCompl2, int nWords );
+static void Abc_TtScalarOr( word * pOut, word * pIn1, word * pIn2, int nWords );
+static void Abc_TtScalarSharp( word * pOut, word * pIn1, word * pIn2, int nWords );
+static void Abc_TtScalarXor( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl );
+static int  Abc_TtScalarEqual( word * pIn1, word * pIn2, int nWords );
+static int  Abc_TtScalarIsConst0( word * pIn1, int nWords );
+static int  Abc_TtScalarCountOnes( word * pIn1, int nWords );
+static void Abc_TtScalarSwap( word * pIn1, word * pIn2, int nWords );
+
+// the scalar kernels are used until Abc_TtSimdStart() is called
+void (*Abc_TtSimdAnd)( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl ) = Abc_TtScalarAnd;
+void (*Abc_TtSimdAndCompl)( word * pOut, word * pIn1, int fCompl1, word * pIn2, int fCompl2, int nWords ) = Abc_TtScalarAndCompl;
+void (*Abc_TtSimdOr)( word * pOut, word * pIn1, word * pIn2, int nWords ) = Abc_TtScalarOr;
+void (*Abc_TtSimdSharp)( word * pOut, word * pIn1, word * pIn2, int nWords ) = Abc_TtScalarSharp;
+void (*Abc_TtSimdXor)( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl ) = Abc_TtScalarXor;
+int  (*Abc_TtSimdEqual)( word * pIn1, word * pIn2, int nWords ) = Abc_TtScalarEqual;
+int  (*Abc_TtSimdIsConst0)( word * pIn1, int nWords ) = Abc_TtScalarIsConst0;
+int  (*Abc_TtSimdCountOnes)( word * pIn1, int nWords ) = Abc_TtScalarCountOnes;
+void (*Abc_TtSimdSwap)( word * pIn1, word * pIn2, int nWords ) = Abc_TtScalarSwap;
+
+// the instruction set supported by the CPU (0 = none, 1 = AVX2, 2 = AVX-512, 3 = AVX-512 with VPOPCNTDQ)
+static int s_TtSimdLevel = 0;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Scalar kernels.]
+
+  Description [Used for the tables with ABC_TT_SIMD_WORDS_MIN words or
+  more when the CPU has no vector extensions.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_TtScalarAnd( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
+{
+    word Flip = fCompl ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn1[w] & pIn2[w]) ^ Flip;
+}
+static void Abc_TtScalarAndCompl( word * pOut, word * pIn1, int fCompl1, word * pIn2, int fCompl2, int nWords )
+{
+    word Flip1 = fCompl1 ? ~(word)0 : 0;
+    word Flip2 = fCompl2 ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn1[w] ^ Flip1) & (pIn2[w] ^ Flip2);
+}
+static void Abc_TtScalarOr( word * pOut, word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn1[w] | pIn2[w];
+}
+static void Abc_TtScalarSharp( word * pOut, word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn1[w] & ~pIn2[w];
+}
+static void Abc_TtScalarXor( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
+{
+    word Flip = fCompl ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = pIn1[w] ^ pIn2[w] ^ Flip;
+}
+static int Abc_TtScalarEqual( word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( pIn1[w] != pIn2[w] )
+            return 0;
+    return 1;
+}
+static int Abc_TtScalarIsConst0( word * pIn1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        if ( pIn1[w] )
+            return 0;
+    return 1;
+}
+static int Abc_TtScalarCountOnes( word * pIn1, int nWords )
+{
+    int w, Count = 0;
+    for ( w = 0; w < nWords; w++ )
+        Count += Abc_TtCountOnes2( pIn1[w] );
+    return Count;
+}
+static void Abc_TtScalarSwap( word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        ABC_SWAP( word, pIn1[w], pIn2[w] );
+}
+
+#ifdef ABC_TT_USE_SIMD
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels.]
+
+  Description [Each iteration processes 4 words; the remaining words are
+  processed one at a time. The arrays do not have to be aligned.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define ABC_TT_AVX2 __attribute__((target("avx2")))
+
+ABC_TT_AVX2 static void Abc_TtAvx2And( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
+{
+    __m256i Mask = _mm256_set1_epi64x( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn2 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_and_si256(a, b), Mask) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = fCompl ? ~(pIn1[w] & pIn2[w]) : pIn1[w] & pIn2[w];
+}
+ABC_TT_AVX2 static void Abc_TtAvx2AndCompl( word * pOut, word * pIn1, int fCompl1, word * pIn2, int fCompl2, int nWords )
+{
+    __m256i Mask1 = _mm256_set1_epi64x( fCompl1 ? -1 : 0 );
+    __m256i Mask2 = _mm256_set1_epi64x( fCompl2 ? -1 : 0 );
+    word Flip1 = fCompl1 ? ~(word)0 : 0;
+    word Flip2 = fCompl2 ? ~(word)0 : 0;
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn2 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(_mm256_xor_si256(a, Mask1), _mm256_xor_si256(b, Mask2)) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn1[w] ^ Flip1) & (pIn2[w] ^ Flip2);
+}
+ABC_TT_AVX2 static void Abc_TtAvx2Or( word * pOut, word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn2 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_or_si256(a, b) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = pIn1[w] | pIn2[w];
+}
+ABC_TT_AVX2 static void Abc_TtAvx2Sharp( word * pOut, word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn2 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_andnot_si256(b, a) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = pIn1[w] & ~pIn2[w];
+}
+ABC_TT_AVX2 static void Abc_TtAvx2Xor( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
+{
+    __m256i Mask = _mm256_set1_epi64x( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn2 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(a, b), Mask) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = fCompl ? pIn1[w] ^ ~pIn2[w] : pIn1[w] ^ pIn2[w];
+}
+ABC_TT_AVX2 static int Abc_TtAvx2Equal( word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn2 + w) );
+        __m256i x = _mm256_xor_si256( a, b );
+        if ( !_mm256_testz_si256(x, x) )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( pIn1[w] != pIn2[w] )
+            return 0;
+    return 1;
+}
+ABC_TT_AVX2 static int Abc_TtAvx2IsConst0( word * pIn1, int nWords )
+{
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        if ( !_mm256_testz_si256(a, a) )
+            return 0;
+    }
+    for ( ; w < nWords; w++ )
+        if ( pIn1[w] )
+            return 0;
+    return 1;
+}
+// counts the bits in each byte using the nibble lookup and sums the bytes of each word
+ABC_TT_AVX2 static int Abc_TtAvx2CountOnes( word * pIn1, int nWords )
+{
+    const __m256i Table = _mm256_setr_epi8( 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4, 0,1,1,2,1,2,2,3,1,2,2,3,2,3,3,4 );
+    const __m256i Low   = _mm256_set1_epi8( 0x0F );
+    __m256i Sum = _mm256_setzero_si256();
+    word Res[4];
+    int w, Count;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a  = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i lo = _mm256_shuffle_epi8( Table, _mm256_and_si256(a, Low) );
+        __m256i hi = _mm256_shuffle_epi8( Table, _mm256_and_si256(_mm256_srli_epi16(a, 4), Low) );
+        Sum = _mm256_add_epi64( Sum, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()) );
+    }
+    _mm256_storeu_si256( (__m256i *)Res, Sum );
+    Count = (int)(Res[0] + Res[1] + Res[2] + Res[3]);
+    for ( ; w < nWords; w++ )
+        Count += Abc_TtCountOnes( pIn1[w] );
+    return Count;
+}
+ABC_TT_AVX2 static void Abc_TtAvx2Swap( word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (__m256i *)(pIn1 + w) );
+        __m256i b = _mm256_loadu_si256( (__m256i *)(pIn2 + w) );
+        _mm256_storeu_si256( (__m256i *)(pIn1 + w), b );
+        _mm256_storeu_si256( (__m256i *)(pIn2 + w), a );
+    }
+    for ( ; w < nWords; w++ )
+        ABC_SWAP( word, pIn1[w], pIn2[w] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels.]
+
+  Description [Each iteration processes 8 words; the remaining words are
+  processed by the AVX2 kernels. Counting ones uses VPOPCNTQ when the CPU
+  supports it (see Abc_TtSimdStart).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define ABC_TT_AVX512 __attribute__((target("avx512f,avx2")))
+
+ABC_TT_AVX512 static void Abc_TtAvx512And( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
+{
+    __m512i Mask = _mm512_set1_epi64( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn2 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_and_si512(a, b), Mask) );
+    }
+    if ( w < nWords )
+        Abc_TtAvx2And( pOut + w, pIn1 + w, pIn2 + w, nWords - w, fCompl );
+}
+ABC_TT_AVX512 static void Abc_TtAvx512AndCompl( word * pOut, word * pIn1, int fCompl1, word * pIn2, int fCompl2, int nWords )
+{
+    __m512i Mask1 = _mm512_set1_epi64( fCompl1 ? -1 : 0 );
+    __m512i Mask2 = _mm512_set1_epi64( fCompl2 ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn2 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(_mm512_xor_si512(a, Mask1), _mm512_xor_si512(b, Mask2)) );
+    }
+    if ( w < nWords )
+        Abc_TtAvx2AndCompl( pOut + w, pIn1 + w, fCompl1, pIn2 + w, fCompl2, nWords - w );
+}
+ABC_TT_AVX512 static void Abc_TtAvx512Or( word * pOut, word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn2 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_or_si512(a, b) );
+    }
+    if ( w < nWords )
+        Abc_TtAvx2Or( pOut + w, pIn1 + w, pIn2 + w, nWords - w );
+}
+ABC_TT_AVX512 static void Abc_TtAvx512Sharp( word * pOut, word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn2 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_andnot_si512(b, a) );
+    }
+    if ( w < nWords )
+        Abc_TtAvx2Sharp( pOut + w, pIn1 + w, pIn2 + w, nWords - w );
+}
+ABC_TT_AVX512 static void Abc_TtAvx512Xor( word * pOut, word * pIn1, word * pIn2, int nWords, int fCompl )
+{
+    __m512i Mask = _mm512_set1_epi64( fCompl ? -1 : 0 );
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn2 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_xor_si512(_mm512_xor_si512(a, b), Mask) );
+    }
+    if ( w < nWords )
+        Abc_TtAvx2Xor( pOut + w, pIn1 + w, pIn2 + w, nWords - w, fCompl );
+}
+ABC_TT_AVX512 static int Abc_TtAvx512Equal( word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn2 + w) );
+        if ( _mm512_cmpneq_epi64_mask(a, b) )
+            return 0;
+    }
+    return w == nWords || Abc_TtAvx2Equal( pIn1 + w, pIn2 + w, nWords - w );
+}
+ABC_TT_AVX512 static int Abc_TtAvx512IsConst0( word * pIn1, int nWords )
+{
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        if ( _mm512_test_epi64_mask(a, a) )
+            return 0;
+    }
+    return w == nWords || Abc_TtAvx2IsConst0( pIn1 + w, nWords - w );
+}
+ABC_TT_AVX512 static void Abc_TtAvx512Swap( word * pIn1, word * pIn2, int nWords )
+{
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (void *)(pIn1 + w) );
+        __m512i b = _mm512_loadu_si512( (void *)(pIn2 + w) );
+        _mm512_storeu_si512( (void *)(pIn1 + w), b );
+        _mm512_storeu_si512( (void *)(pIn2 + w), a );
+    }
+    if ( w < nWords )
+        Abc_TtAvx2Swap( pIn1 + w, pIn2 + w, nWords - w );
+}
+__attribute__((target("avx512f,avx512vpopcntdq,avx2"))) static int Abc_TtAvx512CountOnes( word * pIn1, int nWords )
+{
+    __m512i Sum = _mm512_setzero_si512();
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+        Sum = _mm512_add_epi64( Sum, _mm512_popcnt_epi64(_mm512_loadu_si512((void *)(pIn1 + w))) );
+    return (int)_mm512_reduce_add_epi64(Sum) + (w == nWords ? 0 : Abc_TtAvx2CountOnes( pIn1 + w, nWords - w ));
+}
+
+#endif // ABC_TT_USE_SIMD
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels according to the features of the CPU.]
+
+  Description [Abc_TtSimdStart() is called once when the framework is
+  started; the inline operations of utilTruth.h call the selected kernels
+  through the pointers without checking the CPU again. Without SIMD
+  support, the scalar kernels stay selected.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_TtSimdSelect( int Level )
+{
+    Abc_TtSimdAnd       = Abc_TtScalarAnd;
+    Abc_TtSimdAndCompl  = Abc_TtScalarAndCompl;
+    Abc_TtSimdOr        = Abc_TtScalarOr;
+    Abc_TtSimdSharp     = Abc_TtScalarSharp;
+    Abc_TtSimdXor       = Abc_TtScalarXor;
+    Abc_TtSimdEqual     = Abc_TtScalarEqual;
+    Abc_TtSimdIsConst0  = Abc_TtScalarIsConst0;
+    Abc_TtSimdCountOnes = Abc_TtScalarCountOnes;
+    Abc_TtSimdSwap      = Abc_TtScalarSwap;
+#ifdef ABC_TT_USE_SIMD
+    if ( Level >= 1 )
+    {
+        Abc_TtSimdAnd       = Abc_TtAvx2And;
+        Abc_TtSimdAndCompl  = Abc_TtAvx2AndCompl;
+        Abc_TtSimdOr        = Abc_TtAvx2Or;
+        Abc_TtSimdSharp     = Abc_TtAvx2Sharp;
+        Abc_TtSimdXor       = Abc_TtAvx2Xor;
+        Abc_TtSimdEqual     = Abc_TtAvx2Equal;
+        Abc_TtSimdIsConst0  = Abc_TtAvx2IsConst0;
+        Abc_TtSimdCountOnes = Abc_TtAvx2CountOnes;
+        Abc_TtSimdSwap      = Abc_TtAvx2Swap;
+    }
+    if ( Level >= 2 )
+    {
+        Abc_TtSimdAnd       = Abc_TtAvx512And;
+        Abc_TtSimdAndCompl  = Abc_TtAvx512AndCompl;
+        Abc_TtSimdOr        = Abc_TtAvx512Or;
+        Abc_TtSimdSharp     = Abc_TtAvx512Sharp;
+        Abc_TtSimdXor       = Abc_TtAvx512Xor;
+        Abc_TtSimdEqual     = Abc_TtAvx512Equal;
+        Abc_TtSimdIsConst0  = Abc_TtAvx512IsConst0;
+        Abc_TtSimdSwap      = Abc_TtAvx512Swap;
+    }
+    if ( Level >= 3 )
+        Abc_TtSimdCountOnes = Abc_TtAvx512CountOnes;
+#endif
+}
+void Abc_TtSimdStart()
+{
+#ifdef ABC_TT_USE_SIMD
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx2") )
+        s_TtSimdLevel = 1;
+    if ( s_TtSimdLevel && __builtin_cpu_supports("avx512f") )
+        s_TtSimdLevel = 2;
+    if ( s_TtSimdLevel == 2 && __builtin_cpu_supports("avx512vpopcntdq") )
+        s_TtSimdLevel = 3;
+#endif
+    Abc_TtSimdSelect( s_TtSimdLevel );
+}
+const char * Abc_TtSimdName()
+{
+    return s_TtSimdLevel >= 2 ? "avx512" : s_TtSimdLevel == 1 ? "avx2" : "scalar";
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the scalar and the vectorized kernels.]
+
+  Description [For each number of variables, runs the operations of 
+  utilTruth.h on random tables, first with the scalar code and then with
+  the kernels selected by Abc_TtSimdStart(), checks that the results are
+  the same, and prints the speedups. The number of calls is scaled to
+  process the same number of words for any table size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static abctime Abc_TtSimdBenchOne( word * pOut, word * pIn1, word * pIn2, int nVars, int nCalls, int Kernel, int * pRes )
+{
+    abctime clk = Abc_Clock();
+    int i, nWords = Abc_TtWordNum(nVars), Res = 0;
+    for ( i = 0; i < nCalls; i++ )
+    {
+        switch ( Kernel )
+        {
+        case 0: Abc_TtAnd( pOut, pIn1, pIn2, nWords, i & 1 );        break;
+        case 1: Abc_TtOr( pOut, pIn1, pIn2, nWords );                break;
+        case 2: Abc_TtSharp( pOut, pIn1, pIn2, nWords );             break;
+        case 3: Abc_TtXor( pOut, pIn1, pIn2, nWords, i & 1 );        break;
+        case 4: Res += Abc_TtEqual( pIn1, pIn2, nWords );            break;
+        case 5: Res += Abc_TtCountOnesVec( pIn1, nWords );           break;
+        case 6: Abc_TtCofactor0( pOut, nWords, nVars - 1 - (i & 1) ); break;
+        case 7: Abc_TtSwapVars( pOut, nVars, nVars - 2, nVars - 1 ); break;
+        case 8: Abc_TtAndCompl( pOut, pIn1, i & 1, pIn2, (i >> 1) & 1, nWords ); break;
+        }
+    }
+    *pRes = Res + (int)pOut[nWords-1];
+    return Abc_Clock() - clk;
+}
+void Abc_TtSimdBench( int nVarsMin, int nVarsMax, int nWordsTotal, int fVerbose )
+{
+    char * pNames[9] = { "and", "or", "sharp", "xor", "equal", "count", "cof", "swap", "andc" };
+    int nWordsMax = Abc_TtWordNum( nVarsMax );
+    word * pIn1, * pIn2, * pOut, * pRef;
+    int nVars, Kernel, w, nCalls, Res0, Res1;
+    abctime clk0, clk1;
+    assert( 7 <= nVarsMin && nVarsMin <= nVarsMax );
+    if ( s_TtSimdLevel == 0 )
+    {
+        printf( "The truth table kernels are not vectorized on this CPU.\n" );
+        return;
+    }
+    printf( "Speedup of the truth table kernels (%s; used for tables with %d words or more):\n", Abc_TtSimdName(), ABC_TT_SIMD_WORDS_MIN );
+    pIn1 = ABC_ALLOC( word, nWordsMax );
+    pIn2 = ABC_ALLOC( word, nWordsMax );
+    pOut = ABC_ALLOC( word, nWordsMax );
+    pRef = ABC_ALLOC( word, nWordsMax );
+    printf( "Vars  Words " );
+    for ( Kernel = 0; Kernel < 9; Kernel++ )
+        printf( "%8s", pNames[Kernel] );
+    printf( "\n" );
+    Abc_Random( 1 );
+    for ( nVars = nVarsMin; nVars <= nVarsMax; nVars++ )
+    {
+        int nWords = Abc_TtWordNum( nVars );
+        nCalls = Abc_MaxInt( 1, nWordsTotal / nWords );
+        printf( "%4d %6d ", nVars, nWords );
+        for ( Kernel = 0; Kernel < 9; Kernel++ )
+        {
+            for ( w = 0; w < nWords; w++ )
+                pIn1[w] = pIn2[w] = pOut[w] = Abc_RandomW( 0 );
+            // make the tables differ only in the last word, so that equality checks the whole table
+            pIn2[nWords-1] ^= 1;
+            Abc_TtSimdSelect( 0 );
+            clk0 = Abc_TtSimdBenchOne( pOut, pIn1, pIn2, nVars, nCalls, Kernel, &Res0 );
+            memcpy( pRef, pOut, sizeof(word) * nWords );
+            for ( w = 0; w < nWords; w++ )
+                pOut[w] = pIn1[w];
+            Abc_TtSimdSelect( s_TtSimdLevel );
+            clk1 = Abc_TtSimdBenchOne( pOut, pIn1, pIn2, nVars, nCalls, Kernel, &Res1 );
+            if ( Res0 != Res1 || memcmp(pRef, pOut, sizeof(word) * nWords) )
+                printf( "%8s", "FAIL" );
+            else
+                printf( "%8.2f", 1.0 * Abc_MaxInt((int)clk0, 1) / Abc_MaxInt((int)clk1, 1) );
+            if ( fVerbose )
+                printf( " (%.3f/%.3f sec)", 1.0*clk0/CLOCKS_PER_SEC, 1.0*clk1/CLOCKS_PER_SEC );
+        }
+        printf( "\n" );
+    }
+    ABC_FREE( pIn1 );
+    ABC_FREE( pIn2 );
+    ABC_FREE( pOut );
+    ABC_FREE( pRef );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -105,7 +105,12 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
+// each thread rewrites with its own copy of the library
+#ifdef _MSC_VER
 static Dar_Lib_t * s_DarLib = NULL;
+#else
+static __thread Dar_Lib_t * s_DarLib = NULL;
+#endif
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -477,8 +482,10 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 ***********************************************************************/
 void Dar_LibPrepare( int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
+    Dar_Lib_t * p;
     int i, k, nNodes0Total;
+    Dar_LibStart();
+    p = s_DarLib;
     if ( p->nSubgraphs == nSubgraphs )
         return;
 
@@ -614,7 +621,8 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
+    if ( s_DarLib == NULL )
+        return;
     Dar_LibFree( s_DarLib );
     s_DarLib = NULL;
 }
@@ -1530,6 +1530,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     // start the manager
     p = Ga2_ManStart( pAig, pPars );
     p->timeInit = Abc_Clock() - clk;
+    // start the speculative solvers
+    if ( pPars->nProcs > 0 )
+        Gia_GlaSpecStart( pPars->nProcs );
     // perform initial abstraction
     if ( p->pPars->fVerbose )
     {
@@ -1604,6 +1607,15 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
             // skip checking if we need to skip several starting frames (&gla -S <num>)
             if ( p->pPars->nFramesStart && f <= p->pPars->nFramesStart )
                 continue;
+            // skip checking if the frame was proved by the speculative solvers (&gla -J <num>)
+            if ( p->pPars->nProcs > 0 && f <= Gia_GlaSpecProved() )
+            {
+                if ( p->pPars->iFrameProved < f )
+                    p->pPars->iFrameProved = f;
+                if ( pPars->fVerbose )
+                    Ga2_ManAbsPrintFrame( p, f, 0, 0, Abc_Clock() - clk, 1 );
+                continue;
+            }
             // get the output literal
 //            Lit = Ga2_ManUnroll_rec( p, Gia_ManPo(pAig,0), f );
             Lit = Ga2_ObjFindLit( p, Gia_ObjFanin0(Gia_ManPo(pAig,0)), f );
@@ -1789,6 +1801,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     goto finish;
                 }
             }
+            // solve the next frames of the current abstraction in the background
+            if ( pPars->nProcs > 0 )
+                Gia_GlaSpecLaunch( pAig, f, pPars->nFramesMax );
             // check the number of stable frames
             if ( p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim )
             {
@@ -1839,6 +1854,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     }
 finish:
     Prf_ManStopP( &p->pSat->pPrf2 );
+    // stop the speculative solvers
+    if ( pPars->nProcs > 0 )
+        Gia_GlaSpecStop( pPars->fVerbose );
     // cancel old one if it is proving
     if ( iFrameTryToProve >= 0 )
         Gia_GlaProveCancel( pPars->fVerbose );
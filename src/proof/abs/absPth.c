@@ -21,6 +21,7 @@
 #include "abs.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "sat/bmc/bmc.h"
 
 
 #ifdef ABC_USE_PTHREADS
@@ -45,6 +46,10 @@ ABC_NAMESPACE_IMPL_START
 void Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose ) {}
 void Gia_GlaProveCancel( int fVerbose )                                    {}
 int  Gia_GlaProveCheck( int fVerbose )                                     { return 0; }
+void Gia_GlaSpecStart( int nProcs )                                        {}
+void Gia_GlaSpecLaunch( Gia_Man_t * p, int iFrame, int nFramesMax )        {}
+int  Gia_GlaSpecProved()                                                   { return -1; }
+void Gia_GlaSpecStop( int fVerbose )                                       {}
 
 #else // pthreads are used
 
@@ -64,6 +69,32 @@ static volatile int g_fAbstractionProved = 0;  // set to 1 when prover successed
 // call back procedure for PDR
 int Abs_CallBackToStop( int RunId ) { assert( RunId <= g_nRunIds ); return RunId < g_nRunIds; }
 
+#define ABS_SPEC_THR_MAX 64     // the max number of speculative solvers
+#define ABS_SPEC_STEP     4     // the number of frames added by one speculative job
+
+// information given to the speculative solver
+typedef struct Abs_SpecData_t_
+{
+    Aig_Man_t *   pAig;         // the abstraction to solve
+    int           iFrame;       // the last frame to check
+    int           RunId;        // the run of this job
+    int           RetValue;     // the result
+    int           fStarted;     // the thread was started
+    volatile int  fBusy;        // the thread is running
+    pthread_t     Thread;       // the thread
+} Abs_SpecData_t;
+
+// speculative solvers working on the next frames of the abstraction
+static Abs_SpecData_t g_SpecData[ABS_SPEC_THR_MAX];
+static int g_nSpecThreads = 0;                 // the number of speculative solvers
+static int g_iSpecFrameNext = -1;              // the last frame requested from the solvers
+static volatile int g_iSpecFrameProved = -1;   // the last frame proved by the solvers
+static volatile int g_nSpecRunIds = 0;         // the number of the last speculative run
+static int g_nSpecJobs = 0, g_nSpecSat = 0;    // statistics
+
+// call back procedure for BMC
+int Abs_SpecCallBackToStop( int RunId ) { return RunId < g_nSpecRunIds; }
+
 // test procedure to replace PDR
 int Pdr_ManSolve_test( Aig_Man_t * pAig, Pdr_Par_t * pPars, Abc_Cex_t ** ppCex )
 {
@@ -194,6 +225,125 @@ int Gia_GlaProveCheck( int fVerbose )
     return 1;
 }
 
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the next frames of the abstraction speculatively.]
+
+  Description [Each job runs BMC on a snapshot of the abstraction up to
+  the frame given to it. Adding gates to the abstraction can only make
+  the abstract model more constrained, so if the snapshot has no
+  counter-example up to this frame, neither do the later abstractions,
+  and GLA can skip checking these frames while it refines.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abs_SpecThread( void * pArg )
+{
+    Abs_SpecData_t * pThData = (Abs_SpecData_t *)pArg;
+    Saig_ParBmc_t Pars, * pPars = &Pars;
+    int status;
+    Saig_ParBmcSetDefaultParams( pPars );
+    pPars->nFramesMax = pThData->iFrame + 1;
+    pPars->fSilent    = 1;
+    pPars->RunId      = pThData->RunId;
+    pPars->pFuncStop  = Abs_SpecCallBackToStop;
+    pThData->RetValue = Saig_ManBmcScalable( pThData->pAig, pPars );
+    // update the result
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    if ( pThData->RunId == g_nSpecRunIds )
+    {
+        if ( pThData->RetValue == 0 ) // the snapshot is too coarse; continue from the current frame
+            g_iSpecFrameNext = -1, g_nSpecSat++;
+        else if ( (pThData->RetValue == 1 || pPars->iFrame >= pThData->iFrame) && g_iSpecFrameProved < pThData->iFrame )
+            g_iSpecFrameProved = pThData->iFrame;
+    }
+    pThData->fBusy = 0;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    // quit this thread
+    Aig_ManStop( pThData->pAig );
+    pThData->pAig = NULL;
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+void Gia_GlaSpecStart( int nProcs )
+{
+    int status;
+    assert( g_nSpecThreads == 0 );
+    memset( g_SpecData, 0, sizeof(Abs_SpecData_t) * ABS_SPEC_THR_MAX );
+    g_nSpecThreads = Abc_MinInt( nProcs, ABS_SPEC_THR_MAX );
+    g_nSpecJobs = g_nSpecSat = 0;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    g_iSpecFrameNext = g_iSpecFrameProved = -1;
+    g_nSpecRunIds++;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+}
+void Gia_GlaSpecLaunch( Gia_Man_t * pGia, int iFrame, int nFramesMax )
+{
+    Abs_SpecData_t * pThData;
+    Gia_Man_t * pAbs;
+    int i, status, iTarget;
+    assert( pGia->vGateClasses != NULL );
+    for ( i = 0; i < g_nSpecThreads; i++ )
+    {
+        pThData = g_SpecData + i;
+        if ( pThData->fBusy )
+            continue;
+        if ( pThData->fStarted )
+        {
+            status = pthread_join( pThData->Thread, NULL );  assert( status == 0 );
+            pThData->fStarted = 0;
+        }
+        status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+        iTarget = Abc_MaxInt( Abc_MaxInt(g_iSpecFrameNext, g_iSpecFrameProved), iFrame ) + ABS_SPEC_STEP;
+        if ( nFramesMax && iTarget >= nFramesMax )
+            iTarget = -1;
+        else
+            g_iSpecFrameNext = iTarget;
+        status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+        if ( iTarget == -1 )
+            break;
+        // create the snapshot of the abstraction
+        pAbs = Gia_ManDupAbsGates( pGia, pGia->vGateClasses );
+        Gia_ManCleanValue( pGia );
+        pThData->pAig     = Gia_ManToAigSimple( pAbs );
+        Gia_ManStop( pAbs );
+        pThData->iFrame   = iTarget;
+        pThData->RunId    = g_nSpecRunIds;
+        pThData->RetValue = -1;
+        pThData->fBusy    = 1;
+        pThData->fStarted = 1;
+        status = pthread_create( &pThData->Thread, NULL, Abs_SpecThread, pThData );
+        assert( status == 0 );
+        g_nSpecJobs++;
+    }
+}
+int Gia_GlaSpecProved()
+{
+    return g_iSpecFrameProved;
+}
+void Gia_GlaSpecStop( int fVerbose )
+{
+    int i, status;
+    status = pthread_mutex_lock(&g_mutex);  assert( status == 0 );
+    g_nSpecRunIds++;
+    status = pthread_mutex_unlock(&g_mutex);  assert( status == 0 );
+    for ( i = 0; i < g_nSpecThreads; i++ )
+        if ( g_SpecData[i].fStarted )
+        {
+            status = pthread_join( g_SpecData[i].Thread, NULL );  assert( status == 0 );
+            g_SpecData[i].fStarted = 0;
+        }
+    if ( fVerbose )
+        Abc_Print( 1, "Speculative solvers: Threads = %d. Jobs = %d. Failed = %d. Frames proved = %d.\n", 
+            g_nSpecThreads, g_nSpecJobs, g_nSpecSat, g_iSpecFrameProved+1 );
+    g_nSpecThreads = 0;
+}
+
 #endif // pthreads are used
 
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,206 @@
+/**CFile****************************************************************
+
+  FileName    [cecCorrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Concurrent solving of speculatively reduced models.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "cecInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+Vec_Int_t * Cec_ManSatSolveMiterPar( Gia_Man_t * pAig, int nConfs, int nProcs, Vec_Str_t ** pvStatus )
+{
+    return Cbs_ManSolveMiterNc( pAig, nConfs, pvStatus, 0, 0 );
+}
+
+#else // pthreads are used
+
+#define CEC_PAR_THR_MAX  100     // the max number of threads
+#define CEC_PAR_SHARDS     4     // the number of shards per thread
+
+// one group of outputs of the speculatively reduced model
+typedef struct Cec_ParShard_t_ Cec_ParShard_t;
+struct Cec_ParShard_t_
+{
+    int              iFirst;     // the first output
+    int              iStop;      // the output after the last one
+    Vec_Int_t *      vCexStore;  // counter-examples
+    Vec_Str_t *      vStatus;    // output statuses
+};
+
+// information shared by the threads
+typedef struct Cec_ParQueue_t_ Cec_ParQueue_t;
+struct Cec_ParQueue_t_
+{
+    int              nConfs;     // conflict limit at a node
+    Vec_Int_t *      vDrivers;   // the driver literals of the outputs
+    Cec_ParShard_t * pShards;    // the shards
+    int              nShards;    // the number of shards
+    int              iNext;      // the next shard to solve
+    pthread_mutex_t  Mutex;      // protects the queue
+};
+
+// information given to the thread
+typedef struct Cec_ParThData_t_ Cec_ParThData_t;
+struct Cec_ParThData_t_
+{
+    Cec_ParQueue_t * pQueue;     // the shared queue
+    Gia_Man_t *      pAig;       // the copy of the AIG used by this thread
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the shards taken from the queue.]
+
+  Description [The outputs not in the shard are set to constant 0, so
+  that the solver proves them without search.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cec_ManSatSolveMiterParThread( void * pArg )
+{
+    Cec_ParThData_t * pThData = (Cec_ParThData_t *)pArg;
+    Cec_ParQueue_t * p = pThData->pQueue;
+    Cec_ParShard_t * pShard;
+    int i, status;
+    while ( 1 )
+    {
+        status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+        pShard = p->iNext < p->nShards ? p->pShards + p->iNext++ : NULL;
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+        if ( pShard == NULL )
+            break;
+        for ( i = 0; i < Gia_ManPoNum(pThData->pAig); i++ )
+            Gia_ManPatchCoDriver( pThData->pAig, i, (i >= pShard->iFirst && i < pShard->iStop) ? Vec_IntEntry(p->vDrivers, i) : 0 );
+        ABC_FREE( pThData->pAig->pRefs );
+        pShard->vCexStore = Cbs_ManSolveMiterNc( pThData->pAig, p->nConfs, &pShard->vStatus, 0, 0 );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of solving for the POs of the AIG.]
+
+  Description [Divides the outputs into contiguous groups and solves the
+  groups concurrently with the circuit-based solver. Each thread works on
+  its own copy of the AIG, which keeps the object IDs. The solver handles
+  each output independently of the others, and its decisions depend only
+  on the object IDs, so the result is the same as that of the sequential
+  procedure: the status of each output and the counter-examples, in the
+  order of the outputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Cec_ManSatSolveMiterPar( Gia_Man_t * pAig, int nConfs, int nProcs, Vec_Str_t ** pvStatus )
+{
+    Cec_ParThData_t ThData[CEC_PAR_THR_MAX];
+    pthread_t WorkerThread[CEC_PAR_THR_MAX];
+    Cec_ParQueue_t Queue, * p = &Queue;
+    Vec_Int_t * vCexStore;
+    Vec_Str_t * vStatus;
+    Gia_Obj_t * pObj;
+    int i, s, status, nSize;
+    nProcs = Abc_MinInt( nProcs, CEC_PAR_THR_MAX );
+    if ( nProcs < 2 || Gia_ManPoNum(pAig) < 2 * nProcs )
+        return Cbs_ManSolveMiterNc( pAig, nConfs, pvStatus, 0, 0 );
+    // divide the outputs into shards
+    memset( p, 0, sizeof(Cec_ParQueue_t) );
+    p->nConfs   = nConfs;
+    p->vDrivers = Vec_IntAlloc( Gia_ManPoNum(pAig) );
+    Gia_ManForEachPo( pAig, pObj, i )
+        Vec_IntPush( p->vDrivers, Gia_ObjFaninLit0p(pAig, pObj) );
+    nSize       = Abc_MaxInt( 1, (Gia_ManPoNum(pAig) + nProcs * CEC_PAR_SHARDS - 1) / (nProcs * CEC_PAR_SHARDS) );
+    p->nShards  = (Gia_ManPoNum(pAig) + nSize - 1) / nSize;
+    p->pShards  = ABC_CALLOC( Cec_ParShard_t, p->nShards );
+    for ( s = 0; s < p->nShards; s++ )
+    {
+        p->pShards[s].iFirst = s * nSize;
+        p->pShards[s].iStop  = Abc_MinInt( (s + 1) * nSize, Gia_ManPoNum(pAig) );
+    }
+    // solve the shards
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pQueue = p;
+        ThData[i].pAig   = Gia_ManDup( pAig );
+        assert( Gia_ManObjNum(ThData[i].pAig) == Gia_ManObjNum(pAig) );
+        status = pthread_create( WorkerThread + i, NULL, Cec_ManSatSolveMiterParThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+        Gia_ManStop( ThData[i].pAig );
+    }
+    pthread_mutex_destroy( &p->Mutex );
+    // merge the results in the order of the outputs
+    vStatus   = Vec_StrAlloc( Gia_ManPoNum(pAig) );
+    vCexStore = Vec_IntAlloc( 10000 );
+    for ( s = 0; s < p->nShards; s++ )
+    {
+        Cec_ParShard_t * pShard = p->pShards + s;
+        assert( Vec_StrSize(pShard->vStatus) == Gia_ManPoNum(pAig) );
+        for ( i = pShard->iFirst; i < pShard->iStop; i++ )
+            Vec_StrPush( vStatus, Vec_StrEntry(pShard->vStatus, i) );
+        // the other outputs are constant 0 and have no counter-examples
+        Vec_IntAppend( vCexStore, pShard->vCexStore );
+        Vec_IntFree( pShard->vCexStore );
+        Vec_StrFree( pShard->vStatus );
+    }
+    assert( Vec_StrSize(vStatus) == Gia_ManPoNum(pAig) );
+    Vec_IntFree( p->vDrivers );
+    ABC_FREE( p->pShards );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -175,6 +175,8 @@ struct Cec_ManFra_t_
 
 /*=== cecCorr.c ============================================================*/
 extern void                 Cec_ManRefinedClassPrintStats( Gia_Man_t * p, Vec_Str_t * vStatus, int iIter, abctime Time );
+/*=== cecCorrPar.c ============================================================*/
+extern Vec_Int_t *          Cec_ManSatSolveMiterPar( Gia_Man_t * pAig, int nConfs, int nProcs, Vec_Str_t ** pvStatus );
 /*=== cecClass.c ============================================================*/
 extern int                  Cec_ManSimClassRemoveOne( Cec_ManSim_t * p, int i );
 extern int                  Cec_ManSimClassesPrepare( Cec_ManSim_t * p, int LevelMax );
@@ -22,6 +22,17 @@
 #include "misc/util/utilTruth.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -105,6 +116,9 @@ struct Cec4_Man_t_
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
+    // parallel sweeping
+    Vec_Int_t *      vParReprs;      // representatives of pairs resolved by the threads
+    Vec_Int_t *      vParStatus;     // SAT status of pairs resolved by the threads
     // refinement
     Vec_Int_t *      vRefClasses;
     Vec_Int_t *      vRefNodes;
@@ -139,6 +153,20 @@ struct Cec4_Man_t_
     abctime          timeStart;
 };
 
+// parallel SAT sweeping
+#define CEC4_PAR_THR_MAX   100
+#define CEC4_PAR_ROUND_MAX  10
+
+typedef struct Cec4_ThData_t_ Cec4_ThData_t;
+struct Cec4_ThData_t_
+{
+    Cec4_Man_t *     pMan;           // manager over the copy of the AIG
+    Cec_ParFra_t     Pars;           // parameters of this manager
+    Vec_Int_t *      vPairs;         // pairs (iRepr, iObj) to be solved
+    Vec_Int_t *      vStatus;        // SAT status of each pair
+    Vec_Int_t *      vCexes;         // counter-examples (nLits, Lits)
+};
+
 static inline int    Cec4_ObjSatId( Gia_Man_t * p, Gia_Obj_t * pObj )             { return Gia_ObjCopy2Array(p, Gia_ObjId(p, pObj));                                                     }
 static inline int    Cec4_ObjSetSatId( Gia_Man_t * p, Gia_Obj_t * pObj, int Num ) { assert(Cec4_ObjSatId(p, pObj) == -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), Num); Vec_IntPush(&p->vSuppVars, Gia_ObjId(p, pObj)); if ( Gia_ObjIsCi(pObj) ) Vec_IntPushTwo(&p->vCopiesTwo, Gia_ObjId(p, pObj), Num); assert(Vec_IntSize(&p->vVarMap) == Num); Vec_IntPush(&p->vVarMap, Gia_ObjId(p, pObj)); return Num;  }
 static inline void   Cec4_ObjCleanSatId( Gia_Man_t * p, Gia_Obj_t * pObj )        { assert(Cec4_ObjSatId(p, pObj) != -1); Gia_ObjSetCopy2Array(p, Gia_ObjId(p, pObj), -1);               }
@@ -312,6 +340,8 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
     Vec_IntFreeP( &p->vRefBins );
+    Vec_IntFreeP( &p->vParReprs );
+    Vec_IntFreeP( &p->vParStatus );
     ABC_FREE( p->pTable );
     ABC_FREE( p );
 }
@@ -1609,15 +1639,35 @@ int Cec4_ManSolveTwo( Cec4_Man_t * p, int iObj0, int iObj1, int fPhase, int * pf
     //    printf( "*  " );
     return status;
 }
+void Cec4_ManReadCex( Cec4_Man_t * p, Vec_Int_t * vPat )
+{
+    int i, IdAig, IdSat;
+    Vec_IntClear( vPat );
+    if ( p->pPars->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
+            Vec_IntPush( vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray(&p->pNew->vVarMap);
+        for ( i = 0; i < pCex[0]; )
+            Vec_IntPush( vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+    }
+}
 int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
 {
     abctime clk = Abc_Clock();
-    int i, IdAig, IdSat, status, fEasy, RetValue = 1;
+    int i, status, fEasy, RetValue = 1;
     Gia_Obj_t * pObj = Gia_ManObj( p->pAig, iObj );
     Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, iObj) || Vec_BitEntry(p->vCoDrivers, iRepr) : 0;
-    status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
+    if ( p->vParReprs && Vec_IntEntry(p->vParReprs, iObj) == iRepr ) // already resolved by the threads
+        status = Vec_IntEntry(p->vParStatus, iObj), fEasy = 0;
+    else
+        status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
     if ( status == GLUCOSE_SAT )
     {
         int iLit;
@@ -1625,19 +1675,7 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
         //printf( "Disproved: %d == %d.\n", Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value) );
         p->nSatSat++;
         p->nPatterns++;
-        Vec_IntClear( p->vPat );
-        if ( p->pPars->jType == 0 )
-        {
-            Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
-                Vec_IntPush( p->vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
-        }
-        else
-        {
-            int * pCex = sat_solver_read_cex( p->pSat );
-            int * pMap = Vec_IntArray(&p->pNew->vVarMap);
-            for ( i = 0; i < pCex[0]; )
-                Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
-        }
+        Cec4_ManReadCex( p, p->vPat );
         assert( p->pAig->iPatsPi >= 0 && p->pAig->iPatsPi < 64 * p->pAig->nSimWords - 1 );
         p->pAig->iPatsPi++;
         Vec_IntForEachEntry( p->vPat, iLit, i )
@@ -1825,6 +1863,179 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [Candidate pairs are distributed among the threads, each
+  having its own solver over its own copy of the AIG. The counter-examples
+  are used to refine the classes in the main thread, while the proved and
+  undecided pairs are recorded and later applied by the sequential sweep.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec4_ManSolvePairs( Cec4_ThData_t * pThData )
+{
+    Cec4_Man_t * p = pThData->pMan;
+    int i, iRepr, iObj, status, fEasy;
+    Vec_IntClear( pThData->vStatus );
+    Vec_IntClear( pThData->vCexes );
+    Vec_IntForEachEntryDouble( pThData->vPairs, iRepr, iObj, i )
+    {
+        int fCompl  = Gia_ManObj(p->pAig, iObj)->fPhase ^ Gia_ManObj(p->pAig, iRepr)->fPhase;
+        int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, iObj) || Vec_BitEntry(p->vCoDrivers, iRepr) : 0;
+        status = Cec4_ManSolveTwo( p, iRepr, iObj, fCompl, &fEasy, 0, fEffort );
+        Vec_IntPush( pThData->vStatus, status );
+        if ( status != GLUCOSE_SAT )
+            continue;
+        Cec4_ManReadCex( p, p->vPat );
+        Vec_IntPush( pThData->vCexes, Vec_IntSize(p->vPat) );
+        Vec_IntAppend( pThData->vCexes, p->vPat );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Cec4_ManSolvePairsThread( void * pArg )
+{
+    Cec4_ManSolvePairs( (Cec4_ThData_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+#endif
+
+void Cec4_ManSolvePairsAll( Cec4_ThData_t * pThData, int nProcs )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[CEC4_PAR_THR_MAX];
+    int i, status;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec4_ManSolvePairsThread, (void *)(pThData + i) );  
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+    }
+#else
+    int i;
+    for ( i = 0; i < nProcs; i++ )
+        Cec4_ManSolvePairs( pThData + i );
+#endif
+}
+void Cec4_ManAddCexes( Cec4_Man_t * p, Vec_Int_t * vCexes )
+{
+    Gia_Man_t * pAig = p->pAig;
+    int i, k, nLits;
+    for ( i = 0; i < Vec_IntSize(vCexes); i += nLits + 1 )
+    {
+        nLits = Vec_IntEntry( vCexes, i );
+        assert( pAig->iPatsPi >= 0 && pAig->iPatsPi < 64 * pAig->nSimWords - 1 );
+        pAig->iPatsPi++;
+        for ( k = 1; k <= nLits; k++ )
+            Cec4_ObjSimSetInputBit( pAig, Abc_Lit2Var(Vec_IntEntry(vCexes, i+k)), Abc_LitIsCompl(Vec_IntEntry(vCexes, i+k)) );
+        if ( pAig->vPats )
+        {
+            Vec_IntPush( pAig->vPats, nLits+2 );
+            for ( k = 1; k <= nLits; k++ )
+                Vec_IntPush( pAig->vPats, Vec_IntEntry(vCexes, i+k) );
+            Vec_IntPush( pAig->vPats, -1 );
+        }
+        p->nSatSat++;
+        p->nPatterns++;
+        if ( pAig->iPatsPi == 64 * pAig->nSimWords - 2 )
+        {
+            Cec4_ManSimulate( pAig, p );
+            Vec_IntFill( p->vCexStamps, Gia_ManObjNum(pAig), 0 );
+            pAig->iPatsPi = 0;
+            Vec_WrdFill( pAig->vSimsPi, Vec_WrdSize(pAig->vSimsPi), 0 );
+        }
+    }
+}
+void Cec4_ManPerformSweepingPar( Cec4_Man_t * pMan )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Cec4_ThData_t ThData[CEC4_PAR_THR_MAX];
+    int nProcs = Abc_MinInt( pMan->pPars->nProcs, CEC4_PAR_THR_MAX );
+    int i, k, iObj, iRepr, nPairs, nRounds, nSat = 0, nUnsat = 0, nUndec = 0;
+    abctime clk = Abc_Clock();
+    assert( p->pMuxes == NULL && nProcs > 1 );
+    pMan->vParReprs  = Vec_IntStartFull( Gia_ManObjNum(p) );
+    pMan->vParStatus = Vec_IntStart( Gia_ManObjNum(p) );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Gia_Man_t * pCopy = Gia_ManDup( p );
+        assert( Gia_ManObjNum(pCopy) == Gia_ManObjNum(p) );
+        Gia_ManSetPhase( pCopy );
+        Vec_IntFill( &pCopy->vCopies2, Gia_ManObjNum(pCopy), -1 );
+        ThData[k].Pars          = *pMan->pPars;
+        ThData[k].Pars.fVerbose = 0;
+        ThData[k].pMan          = Cec4_ManCreate( pCopy, &ThData[k].Pars );
+        ThData[k].pMan->pNew    = pCopy;
+        ThData[k].vPairs        = Vec_IntAlloc( 1000 );
+        ThData[k].vStatus       = Vec_IntAlloc( 1000 );
+        ThData[k].vCexes        = Vec_IntAlloc( 1000 );
+    }
+    for ( nRounds = 0; nRounds < CEC4_PAR_ROUND_MAX; nRounds++ )
+    {
+        // distribute the pairs not yet resolved for their current representatives
+        for ( k = 0; k < nProcs; k++ )
+            Vec_IntClear( ThData[k].vPairs );
+        nPairs = 0;
+        Gia_ManForEachAndId( p, iObj )
+        {
+            if ( (iRepr = Gia_ObjRepr(p, iObj)) == GIA_VOID || Gia_ObjProved(p, iObj) )
+                continue;
+            if ( pMan->pPars->nLevelMax && Gia_ObjLevelId(p, iObj) > pMan->pPars->nLevelMax )
+                continue;
+            if ( Vec_IntEntry(pMan->vParReprs, iObj) == iRepr )
+                continue;
+            Vec_IntPushTwo( ThData[nPairs++ % nProcs].vPairs, iRepr, iObj );
+        }
+        if ( nPairs == 0 )
+            break;
+        Cec4_ManSolvePairsAll( ThData, nProcs );
+        // record the resolved pairs and refine the classes using the counter-examples
+        for ( k = 0; k < nProcs; k++ )
+        {
+            Vec_IntForEachEntryDouble( ThData[k].vPairs, iRepr, iObj, i )
+            {
+                int status = Vec_IntEntry( ThData[k].vStatus, i/2 );
+                nSat   += status == GLUCOSE_SAT;
+                nUnsat += status == GLUCOSE_UNSAT;
+                nUndec += status == GLUCOSE_UNDEC;
+                if ( status == GLUCOSE_SAT )
+                    continue;
+                Vec_IntWriteEntry( pMan->vParReprs, iObj, iRepr );
+                Vec_IntWriteEntry( pMan->vParStatus, iObj, status );
+            }
+            Cec4_ManAddCexes( pMan, ThData[k].vCexes );
+        }
+        if ( p->iPatsPi > 0 )
+        {
+            Cec4_ManSimulate( p, pMan );
+            Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+            p->iPatsPi = 0;
+            Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+        }
+    }
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Cec4_ManDestroy( ThData[k].pMan );
+        Vec_IntFree( ThData[k].vPairs );
+        Vec_IntFree( ThData[k].vStatus );
+        Vec_IntFree( ThData[k].vCexes );
+    }
+    if ( pMan->pPars->fVerbose )
+    {
+        printf( "Parallel sweeping with %d threads in %d rounds:  P = %d  D = %d  F = %d   ", nProcs, nRounds, nUnsat, nSat, nUndec );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+}
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
@@ -1895,6 +2106,8 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+    if ( pPars->nProcs > 1 && !p->pMuxes )
+        Cec4_ManPerformSweepingPar( pMan );
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -66,6 +66,9 @@ struct Inter_ManParams_t_
     int  fDropInvar;    // dump inductive invariant into file
     int  fVerbose;      // print verbose statistics
     int  iFrameMax;     // the time frame reached
+    int  nProcs;        // the number of concurrent interpolation chains
+    int  RunId;         // the id of this run
+    int(*pFuncStop)(int); // callback to terminate
     char * pFileName;   // file name to dump interpolant
 };
 
@@ -80,6 +83,8 @@ struct Inter_ManParams_t_
 /*=== intCore.c ==========================================================*/
 extern void       Inter_ManSetDefaultParams( Inter_ManParams_t * p );
 extern int        Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame );
+/*=== intPar.c ==========================================================*/
+extern int        Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame );
 
 
 
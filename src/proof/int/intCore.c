@@ -196,6 +196,13 @@ p->timeEqu += Abc_Clock() - clk;
         // iterate the interpolation procedure
         for ( i = 0; ; i++ )
         {
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
             if ( pPars->nFramesMax && p->nFrames + i >= pPars->nFramesMax )
             { 
                 if ( pPars->fVerbose )
@@ -264,7 +271,7 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
-                else
+                else if ( !pPars->pFuncStop || !pPars->pFuncStop(pPars->RunId) ) // not stopped by another chain
                 {
                     assert( p->nConfCur >= p->nConfLimit );
                     if ( pPars->fVerbose )
@@ -69,6 +69,8 @@ struct Inter_Man_t_
     int              nConfCur;     // the current number of conflicts
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
+    int              RunId;        // the id of this run
+    int(*pFuncStop)(int);          // callback to terminate
     char *           pFileName;
     // runtime
     abctime          timeRwr;
@@ -0,0 +1,215 @@
+/**CFile****************************************************************
+
+  FileName    [intPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Concurrent interpolation chains.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    return Inter_ManPerformInterpolation( pAig, pPars, piFrame );
+}
+
+#else // pthreads are used
+
+#define INT_PAR_THR_MAX 100
+
+// information given to the thread
+typedef struct Inter_ThData_t_ Inter_ThData_t;
+struct Inter_ThData_t_
+{
+    Inter_ManParams_t Pars;          // parameters of this chain
+    Aig_Man_t *      pAig;           // copy of the user's AIG
+    int              iFrame;         // the failed frame
+    int              RetValue;       // the result
+    abctime          Time;           // the runtime
+};
+
+// the number of the last run; chains of the earlier runs are stopped
+static volatile int g_nInterRunIds = 0;
+static pthread_mutex_t g_InterMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// call back procedure for the chains
+static int Inter_ManParCallBackToStop( int RunId ) { return RunId < g_nInterRunIds; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one chain.]
+
+  Description [The CNF manager and the rewriting library are allocated
+  for each thread when they are first used and released here.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Inter_ManPerformInterpolationParThread( void * pArg )
+{
+    Inter_ThData_t * pThData = (Inter_ThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    int status;
+    pThData->RetValue = Inter_ManPerformInterpolation( pThData->pAig, &pThData->Pars, &pThData->iFrame );
+    pThData->Time = Abc_Clock() - clk;
+    Cnf_ManFree();
+    Dar_LibStop();
+    // the first chain to finish stops the others
+    if ( pThData->RetValue != -1 )
+    {
+        status = pthread_mutex_lock( &g_InterMutex );  assert( status == 0 );
+        if ( pThData->Pars.RunId == g_nInterRunIds )
+            g_nInterRunIds++;
+        else // another chain has finished first
+            pThData->RetValue = -1;
+        status = pthread_mutex_unlock( &g_InterMutex );  assert( status == 0 );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs several interpolation chains concurrently.]
+
+  Description [The chains differ in the direction of interpolation
+  and in the depth of the inductive containment check. The odd chains
+  toggle backward interpolation. The forward chain i uses K = K0 + i/2,
+  while the backward chains use K = 1 and alternate rewriting of the
+  timeframes. The first chain to prove or disprove the property stops
+  the others. Only the first chain dumps the interpolants.
+  Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    Inter_ThData_t ThData[INT_PAR_THR_MAX];
+    pthread_t WorkerThread[INT_PAR_THR_MAX];
+    int i, status, RunId, iWinner = -1, RetValue = -1;
+    int nProcs = Abc_MinInt( pPars->nProcs, INT_PAR_THR_MAX );
+    abctime clk = Abc_Clock();
+    assert( nProcs > 1 );
+    ABC_FREE( pAig->pSeqModel );
+    *piFrame = -1;
+    if ( Inter_ManCheckInitialState(pAig) )
+    {
+        printf( "Property trivially fails in the initial state.\n" );
+        return 0;
+    }
+    status = pthread_mutex_lock( &g_InterMutex );  assert( status == 0 );
+    RunId = ++g_nInterRunIds;
+    status = pthread_mutex_unlock( &g_InterMutex );  assert( status == 0 );
+    // start the chains
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Inter_ThData_t * pThData = ThData + i;
+        pThData->Pars              = *pPars;
+        pThData->Pars.nProcs       = 0;
+        pThData->Pars.fVerbose     = 0;
+        pThData->Pars.fDropInvar   = pPars->fDropInvar && i == 0;
+        pThData->Pars.RunId        = RunId;
+        pThData->Pars.pFuncStop    = Inter_ManParCallBackToStop;
+        // diversify the chains
+        pThData->Pars.fUseBackward ^= (i & 1);
+        if ( pThData->Pars.fUseBackward )
+        {
+            pThData->Pars.nFramesK    = 1;
+            pThData->Pars.fTransLoop  = 1;
+            pThData->Pars.fRewrite   ^= ((i >> 1) & 1);
+        }
+        else
+            pThData->Pars.nFramesK    = Abc_MaxInt( pPars->nFramesK, 1 ) + i / 2;
+        pThData->pAig              = Aig_ManDupSimple( pAig );
+        pThData->iFrame            = -1;
+        pThData->RetValue          = -1;
+        pThData->Time              = 0;
+        status = pthread_create( WorkerThread + i, NULL, Inter_ManPerformInterpolationParThread, (void *)pThData );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+        if ( ThData[i].RetValue != -1 )
+            iWinner = i, RetValue = ThData[i].RetValue;
+    }
+    // transfer the results
+    pPars->iFrameMax = -1;
+    for ( i = 0; i < nProcs; i++ )
+        pPars->iFrameMax = Abc_MaxInt( pPars->iFrameMax, ThData[i].Pars.iFrameMax );
+    if ( iWinner >= 0 )
+    {
+        pPars->iFrameMax = ThData[iWinner].Pars.iFrameMax;
+        if ( RetValue == 0 )
+        {
+            pAig->pSeqModel = ThData[iWinner].pAig->pSeqModel;
+            ThData[iWinner].pAig->pSeqModel = NULL;
+            if ( pAig->pSeqModel )
+                *piFrame = pAig->pSeqModel->iFrame;
+        }
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            printf( "Chain %2d : K = %2d  %s  Frames = %3d  ", i, ThData[i].Pars.nFramesK,
+                ThData[i].Pars.fUseBackward ? "backward" : "forward ", ThData[i].Pars.iFrameMax );
+            ABC_PRTn( "Time", ThData[i].Time );
+            printf( "%s\n", i == iWinner ? "(solved)" : "" );
+        }
+        printf( "Finished %d interpolation chains.  ", nProcs );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    // cleanup
+    for ( i = 0; i < nProcs; i++ )
+        Aig_ManStop( ThData[i].pAig );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
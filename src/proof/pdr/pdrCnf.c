@@ -439,6 +439,7 @@ static inline sat_solver * Pdr_ManNewSolver2( sat_solver * pSat, Pdr_Man_t * p,
 sat_solver * Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit )
 {
     assert( pSat != NULL );
+    sat_solver_set_inprocess( pSat, 1 );
     if ( p->pPars->fMonoCnf )
         return Pdr_ManNewSolver1( pSat, p, k, fInit );
     else
@@ -206,6 +206,8 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
             }
             // add the last clause
             Vec_PtrPush( vArrayK1, pCubeK );
+            if ( p->pDb )
+                Pdr_ManDbPublish( p, k+1, pCubeK );
             Vec_PtrWriteEntry( vArrayK, j, Vec_PtrEntryLast(vArrayK) );
             Vec_PtrPop(vArrayK);
             j--;
@@ -988,6 +990,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             }
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
+            if ( p->pDb )
+                Pdr_ManDbPublish( p, k, pCubeMin );
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
@@ -1142,6 +1146,12 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     p->pPars->iFrame = iFrame;
                     return -1;
                 }
+                // add the clauses derived by other threads
+                if ( p->pDb && Pdr_ManDbImport( p ) == -1 )
+                {
+                    p->pPars->iFrame = iFrame;
+                    return -1;
+                }
                 RetValue = Pdr_ManCheckCube( p, iFrame, NULL, &pCube, p->pPars->nConfLimit, 0, 1 );
                 if ( RetValue == 1 )
                     break;
@@ -1281,6 +1291,12 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
         assert( pCube == NULL );
         Pdr_ManSetPropertyOutput( p, iFrame );
         Pdr_ManCreateSolver( p, ++iFrame );
+        // add the clauses from the pool
+        if ( p->vPoolCands && IPdr_ManSeedPool( p ) == -1 )
+        {
+            p->pPars->iFrame = iFrame;
+            return -1;
+        }
         if ( fPrintClauses )
         {
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
@@ -1412,8 +1428,12 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSkipGeneral ? "yes" : "no",
             pPars->fSolveAll ?    "yes" : "no" );
     }
+    if ( pPars->nProcs > 1 && Pdr_ManSolveParCanUse(pPars) )
+        return Pdr_ManSolvePar( pAig, pPars );
     ABC_FREE( pAig->pSeqModel );
     p = Pdr_ManStart( pAig, pPars, NULL );
+    if ( pPars->pPoolRead )
+        p->vPoolCands = IPdr_ManReadPool( p, pPars->pPoolRead );
     RetValue = Pdr_ManSolveInt( p );
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
@@ -1432,6 +1452,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     }
     else if ( RetValue == 1 )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+    if ( pPars->pPoolWrite )
+        IPdr_ManWritePool( p, pPars->pPoolWrite );
     p->tTotal += Abc_Clock() - clk;
     Pdr_ManStop( p );
     pPars->iFrame--;
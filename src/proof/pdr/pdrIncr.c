@@ -984,6 +984,206 @@ int IPdr_ManReduceClauses( Pdr_Man_t * p, Vec_Vec_t * vClauses )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes the clause pool into a file.]
+
+  Description [The pool contains all clauses of the frames, each written
+  as the blocked cube preceded by its frame. Flop names, if known, are 
+  used to match the clauses with the flops when the pool is read back 
+  for a modified design.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void IPdr_ManWritePool( Pdr_Man_t * p, char * pFileName )
+{
+    FILE * pFile;
+    Pdr_Set_t * pCla;
+    int i, k, n, nClauses = 0;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( 1, "Cannot open file \"%s\" for writing the clause pool.\n", pFileName );
+        return;
+    }
+    Vec_VecForEachEntryStart( Pdr_Set_t *, p->vClauses, pCla, i, k, 1 )
+        nClauses++;
+    fprintf( pFile, "# PDR clause pool for \"%s\" written by ABC on %s\n", p->pAig->pName ? p->pAig->pName : "", Extra_TimeStamp() );
+    fprintf( pFile, ".flops %d\n", Aig_ManRegNum(p->pAig) );
+    if ( p->pPars->vFlopNames )
+    {
+        char * pName;
+        assert( Vec_PtrSize(p->pPars->vFlopNames) == Aig_ManRegNum(p->pAig) );
+        Vec_PtrForEachEntry( char *, p->pPars->vFlopNames, pName, i )
+            fprintf( pFile, "%s\n", pName );
+    }
+    fprintf( pFile, ".clauses %d\n", nClauses );
+    Vec_VecForEachEntryStart( Pdr_Set_t *, p->vClauses, pCla, i, k, 1 )
+    {
+        fprintf( pFile, "%d", i );
+        for ( n = 0; n < pCla->nLits; n++ )
+            fprintf( pFile, " %d", pCla->Lits[n] );
+        fprintf( pFile, "\n" );
+    }
+    fprintf( pFile, ".end\n" );
+    fclose( pFile );
+    if ( !p->pPars->fSilent )
+        Abc_Print( 1, "Written %d clauses over %d flops into the clause pool \"%s\".\n", nClauses, Aig_ManRegNum(p->pAig), pFileName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the clause pool from a file.]
+
+  Description [Returns the cubes over the flops of the current design.
+  The clauses whose flops cannot be matched are skipped. The cubes are
+  only candidates; they are added to the frames by IPdr_ManSeedPool()
+  after they are checked.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * IPdr_ManReadPool( Pdr_Man_t * p, char * pFileName )
+{
+    FILE * pFile;
+    Vec_Ptr_t * vCubes = NULL;
+    Vec_Int_t * vMap = NULL, * vLits, * vPiLits;
+    Pdr_Set_t * pCube;
+    Abc_Nam_t * pNames = NULL;
+    char * pName, Buffer[1000];
+    int c, i, nFlops, nClauses, Frame, Lit, fSkip, nSkipped = 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        if ( !p->pPars->fSilent )
+            Abc_Print( 1, "Clause pool \"%s\" cannot be opened for reading.\n", pFileName );
+        return NULL;
+    }
+    // skip the comment
+    while ( (c = fgetc(pFile)) == '#' )
+        while ( (c = fgetc(pFile)) != EOF && c != '\n' );
+    ungetc( c, pFile );
+    if ( fscanf( pFile, " .flops %d", &nFlops ) != 1 || nFlops < 0 )
+        goto corrupt;
+    // map the flops of the pool into the flops of the design
+    vMap = Vec_IntStartFull( nFlops );
+    if ( fscanf( pFile, " %999s", Buffer ) != 1 )
+        goto corrupt;
+    if ( strcmp(Buffer, ".clauses") && p->pPars->vFlopNames ) // flop names are given
+    {
+        pNames = Abc_NamStart( Aig_ManRegNum(p->pAig), 20 );
+        Vec_PtrForEachEntry( char *, p->pPars->vFlopNames, pName, i )
+            Abc_NamStrFindOrAdd( pNames, pName, NULL );
+        for ( i = 0; i < nFlops; i++ )
+        {
+            if ( i > 0 && fscanf( pFile, " %999s", Buffer ) != 1 )
+                goto corrupt;
+            Vec_IntWriteEntry( vMap, i, Abc_NamStrFind(pNames, Buffer) - 1 );
+        }
+        if ( fscanf( pFile, " %999s", Buffer ) != 1 )
+            goto corrupt;
+    }
+    else 
+    {
+        // skip the names
+        for ( i = 0; strcmp(Buffer, ".clauses") && i < nFlops; i++ )
+            if ( fscanf( pFile, " %999s", Buffer ) != 1 )
+                goto corrupt;
+        // map by the flop order
+        if ( nFlops == Aig_ManRegNum(p->pAig) )
+            for ( i = 0; i < nFlops; i++ )
+                Vec_IntWriteEntry( vMap, i, i );
+    }
+    if ( strcmp(Buffer, ".clauses") || fscanf( pFile, " %d", &nClauses ) != 1 )
+        goto corrupt;
+    // read the clauses
+    vCubes  = Vec_PtrAlloc( nClauses );
+    vLits   = Vec_IntAlloc( 100 );
+    vPiLits = Vec_IntAlloc( 0 );
+    while ( fscanf( pFile, " %d", &Frame ) == 1 )
+    {
+        Vec_IntClear( vLits );
+        fSkip = 0;
+        while ( (c = fgetc(pFile)) == ' ' && fscanf( pFile, "%d", &Lit ) == 1 )
+        {
+            if ( Abc_Lit2Var(Lit) >= nFlops || Vec_IntEntry(vMap, Abc_Lit2Var(Lit)) == -1 )
+                fSkip = 1;
+            else
+                Vec_IntPush( vLits, Abc_Lit2LitV(Vec_IntArray(vMap), Lit) );
+        }
+        if ( fSkip || Vec_IntSize(vLits) == 0 )
+            nSkipped++;
+        else
+            Vec_PtrPush( vCubes, Pdr_SetCreate(vLits, vPiLits) );
+    }
+    Vec_IntFree( vLits );
+    Vec_IntFree( vPiLits );
+    if ( fscanf( pFile, " %999s", Buffer ) != 1 || strcmp(Buffer, ".end") )
+    {
+        Vec_PtrForEachEntry( Pdr_Set_t *, vCubes, pCube, i )
+            Pdr_SetDeref( pCube );
+        Vec_PtrFreeP( &vCubes );
+        goto corrupt;
+    }
+    if ( !p->pPars->fSilent )
+        Abc_Print( 1, "Read %d clauses over %d flops from the clause pool \"%s\" (%d skipped).\n", Vec_PtrSize(vCubes), nFlops, pFileName, nSkipped );
+    goto finish;
+corrupt:
+    Abc_Print( 1, "Clause pool \"%s\" has wrong format and is not used.\n", pFileName );
+finish:
+    if ( pNames )
+        Abc_NamStop( pNames );
+    Vec_IntFreeP( &vMap );
+    fclose( pFile );
+    return vCubes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses from the pool to the first frame.]
+
+  Description [A clause is added if it holds in the initial state and
+  after one transition from it. Clause pushing moves the clauses that 
+  remain inductive to the later frames.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IPdr_ManSeedPool( Pdr_Man_t * p )
+{
+    Pdr_Set_t * pCube;
+    int i, RetValue = 1, nAdded = 0;
+    assert( Vec_PtrSize(p->vSolvers) == 2 );
+    Vec_PtrForEachEntry( Pdr_Set_t *, p->vPoolCands, pCube, i )
+    {
+        if ( RetValue == -1 || Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, 1, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, 0, pCube, NULL, 0, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        Vec_VecPush( p->vClauses, 1, pCube );   // consume ref
+        Pdr_ManSolverAddClause( p, 1, pCube );
+        nAdded++;
+    }
+    if ( p->pPars->fVerbose )
+        Abc_Print( 1, "Seeded frame 1 with %d out of %d clauses from the clause pool.\n", nAdded, Vec_PtrSize(p->vPoolCands) );
+    Vec_PtrFreeP( &p->vPoolCands );
+    return RetValue == -1 ? -1 : 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -71,6 +71,8 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Txs_Man_t_  Txs_Man_t;
 typedef struct Txs3_Man_t_ Txs3_Man_t;
 
+typedef struct Pdr_Db_t_  Pdr_Db_t;
+
 typedef struct Pdr_Set_t_ Pdr_Set_t;
 struct Pdr_Set_t_
 {
@@ -140,6 +142,13 @@ struct Pdr_Man_t_
     Vec_Int_t * vRes;      // final result
     abctime *   pTime4Outs;// timeout per output
     Vec_Ptr_t * vInfCubes; // infinity clauses/cubes
+    // clauses shared by the threads
+    Pdr_Db_t *  pDb;       // shared clause database
+    int         iDbId;     // the ID of this thread
+    int         iDbRead;   // the number of entries read
+    int         nDbImports;// the number of clauses imported
+    // clause pool
+    Vec_Ptr_t * vPoolCands;// clauses read from the pool
     // statistics
     int         nBlocks;   // the number of times blockState was called
     int         nObligs;   // the number of proof obligations derived
@@ -202,6 +211,11 @@ extern int             Pdr_ManFreeVar( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManNewSolver( sat_solver * pSat, Pdr_Man_t * p, int k, int fInit );
 /*=== pdrCore.c ==========================================================*/
 extern int             Pdr_ManCheckContainment( Pdr_Man_t * p, int k, Pdr_Set_t * pSet );
+extern int             Pdr_ManSolveInt( Pdr_Man_t * p );
+/*=== pdrIncr.c ==========================================================*/
+extern void            IPdr_ManWritePool( Pdr_Man_t * p, char * pFileName );
+extern Vec_Ptr_t *     IPdr_ManReadPool( Pdr_Man_t * p, char * pFileName );
+extern int             IPdr_ManSeedPool( Pdr_Man_t * p );
 /*=== pdrInv.c ==========================================================*/
 extern Vec_Int_t *     Pdr_ManCountFlopsInv( Pdr_Man_t * p );
 extern void            Pdr_ManPrintProgress( Pdr_Man_t * p, int fClose, abctime Time );
@@ -216,6 +230,11 @@ extern Pdr_Man_t *     Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_In
 extern void            Pdr_ManStop( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCex( Pdr_Man_t * p );
 extern Abc_Cex_t *     Pdr_ManDeriveCexAbs( Pdr_Man_t * p );
+/*=== pdrPar.c ==========================================================*/
+extern int             Pdr_ManSolveParCanUse( Pdr_Par_t * pPars );
+extern int             Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars );
+extern void            Pdr_ManDbPublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube );
+extern int             Pdr_ManDbImport( Pdr_Man_t * p );
 /*=== pdrSat.c ==========================================================*/
 extern sat_solver *    Pdr_ManCreateSolver( Pdr_Man_t * p, int k );
 extern sat_solver *    Pdr_ManFetchSolver( Pdr_Man_t * p, int k );
@@ -383,6 +383,12 @@ void Pdr_ManStop( Pdr_Man_t * p )
     Vec_IntFree( p->vCi2Rem   );  // CIs to be removed
     Vec_IntFree( p->vRes      );  // final result
     Vec_PtrFreeP( &p->vInfCubes );
+    if ( p->vPoolCands )
+    {
+        Vec_PtrForEachEntry( Pdr_Set_t *, p->vPoolCands, pCla, i )
+            Pdr_SetDeref( pCla );
+        Vec_PtrFreeP( &p->vPoolCands );
+    }
     ABC_FREE( p->pTime4Outs );
     if ( p->vCexes )
         Vec_PtrFreeFree( p->vCexes );
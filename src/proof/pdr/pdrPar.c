@@ -0,0 +1,366 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Multi-threaded PDR with a shared clause database.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int  Pdr_ManSolveParCanUse( Pdr_Par_t * pPars )                         { return 0;  }
+int  Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )             { return -1; }
+void Pdr_ManDbPublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )        {}
+int  Pdr_ManDbImport( Pdr_Man_t * p )                                   { return 1;  }
+
+#else // pthreads are used
+
+#define PDR_PAR_THR_MAX 100
+
+// clauses shared by the threads
+struct Pdr_Db_t_
+{
+    pthread_mutex_t  Mutex;          // protects the clause log
+    Vec_Int_t *      vLog;           // published clauses (ThreadId, Frame, nLits, Lits)
+    int              nClauses;       // the number of published clauses
+};
+
+// information given to the thread
+typedef struct Pdr_ThData_t_ Pdr_ThData_t;
+struct Pdr_ThData_t_
+{
+    Pdr_Par_t        Pars;           // parameters of this thread
+    Aig_Man_t *      pAig;           // copy of the user's AIG
+    Pdr_Man_t *      pMan;           // PDR manager
+    Pdr_Db_t *       pDb;            // shared clauses
+    int              Id;             // thread ID
+    int              RetValue;       // the result
+};
+
+// the number of the last run; threads of the earlier runs are stopped
+static volatile int g_nPdrRunIds = 0;
+static pthread_mutex_t g_PdrMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// call back procedure for the threads
+static int Pdr_ManParCallBackToStop( int RunId ) { return RunId < g_nPdrRunIds; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the clause derived in frame k.]
+
+  Description [The threads work on identical copies of the AIG, so flop
+  literals are exchanged without translation.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManDbPublish( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Db_t * pDb = p->pDb;
+    int i, status;
+    status = pthread_mutex_lock( &pDb->Mutex );  assert( status == 0 );
+    Vec_IntPush( pDb->vLog, p->iDbId );
+    Vec_IntPush( pDb->vLog, k );
+    Vec_IntPush( pDb->vLog, pCube->nLits );
+    for ( i = 0; i < pCube->nLits; i++ )
+        Vec_IntPush( pDb->vLog, pCube->Lits[i] );
+    pDb->nClauses++;
+    status = pthread_mutex_unlock( &pDb->Mutex );  assert( status == 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses published by other threads.]
+
+  Description [A clause derived by another thread holds in all states
+  reachable in the given number of steps, but it is added to this
+  thread's frame only if it is inductive relative to the previous frame,
+  which keeps the frames of this thread consistent. Returns -1 if the
+  resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManDbImport( Pdr_Man_t * p )
+{
+    Pdr_Db_t * pDb = p->pDb;
+    Vec_Int_t * vNew, * vPiLits;
+    Pdr_Set_t * pCube;
+    int i, k, Id, nLits, status, RetValue = 1;
+    int kMax = Vec_PtrSize(p->vSolvers)-1;
+    if ( kMax < 1 )
+        return 1;
+    // copy the new part of the log
+    status = pthread_mutex_lock( &pDb->Mutex );  assert( status == 0 );
+    if ( p->iDbRead == Vec_IntSize(pDb->vLog) )
+    {
+        status = pthread_mutex_unlock( &pDb->Mutex );  assert( status == 0 );
+        return 1;
+    }
+    vNew = Vec_IntAllocArrayCopy( Vec_IntEntryP(pDb->vLog, p->iDbRead), Vec_IntSize(pDb->vLog) - p->iDbRead );
+    p->iDbRead = Vec_IntSize(pDb->vLog);
+    status = pthread_mutex_unlock( &pDb->Mutex );  assert( status == 0 );
+    // add the clauses
+    vPiLits = Vec_IntAlloc( 0 );
+    for ( i = 0; i < Vec_IntSize(vNew); i += 3 + nLits )
+    {
+        Id    = Vec_IntEntry( vNew, i );
+        k     = Abc_MinInt( Vec_IntEntry(vNew, i+1), kMax );
+        nLits = Vec_IntEntry( vNew, i+2 );
+        if ( Id == p->iDbId )
+            continue;
+        Vec_IntClear( p->vLits );
+        Vec_IntPushArray( p->vLits, Vec_IntEntryP(vNew, i+3), nLits );
+        pCube = Pdr_SetCreate( p->vLits, vPiLits );
+        if ( Pdr_SetIsInit(pCube, -1) || Pdr_ManCheckContainment(p, k, pCube) )
+        {
+            Pdr_SetDeref( pCube );
+            continue;
+        }
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, 0, 0, 1 );
+        if ( RetValue != 1 )
+        {
+            Pdr_SetDeref( pCube );
+            if ( RetValue == -1 )
+                break;
+            RetValue = 1;
+            continue;
+        }
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        for ( Id = 1; Id <= k; Id++ )
+            Pdr_ManSolverAddClause( p, Id, pCube );
+        p->nDbImports++;
+    }
+    Vec_IntFree( vPiLits );
+    Vec_IntFree( vNew );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the parallel mode applies.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolveParCanUse( Pdr_Par_t * pPars )
+{
+    return !pPars->fSolveAll && !pPars->fUseAbs && !pPars->fUseBridge && !pPars->nTimeOutOne && !pPars->pFuncStop;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManSolveParThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    int status;
+    pThData->RetValue = Pdr_ManSolveInt( pThData->pMan );
+    // the first thread to finish stops the others
+    if ( pThData->RetValue != -1 )
+    {
+        status = pthread_mutex_lock( &g_PdrMutex );  assert( status == 0 );
+        if ( pThData->Pars.RunId == g_nPdrRunIds )
+            g_nPdrRunIds++;
+        else // another thread has finished first
+            pThData->RetValue = -1;
+        status = pthread_mutex_unlock( &g_PdrMutex );  assert( status == 0 );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded PDR.]
+
+  Description [Runs the threads with different generalization orders and
+  SAT solver seeds. The clauses are published into the shared database
+  and imported by other threads when they start blocking a new cube.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    Pdr_ThData_t ThData[PDR_PAR_THR_MAX];
+    pthread_t WorkerThread[PDR_PAR_THR_MAX];
+    Pdr_Db_t Db, * pDb = &Db;
+    int i, status, RunId, iWinner = -1, RetValue = -1;
+    int nProcs = Abc_MinInt( pPars->nProcs, PDR_PAR_THR_MAX );
+    abctime clk = Abc_Clock();
+    assert( Pdr_ManSolveParCanUse(pPars) );
+    ABC_FREE( pAig->pSeqModel );
+    status = pthread_mutex_init( &pDb->Mutex, NULL );  assert( status == 0 );
+    pDb->vLog = Vec_IntAlloc( 10000 );
+    pDb->nClauses = 0;
+    status = pthread_mutex_lock( &g_PdrMutex );  assert( status == 0 );
+    RunId = ++g_nPdrRunIds;
+    status = pthread_mutex_unlock( &g_PdrMutex );  assert( status == 0 );
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Pdr_ThData_t * pThData = ThData + i;
+        pThData->Pars              = *pPars;
+        pThData->Pars.nProcs       = 0;
+        pThData->Pars.fVerbose     = 0;
+        pThData->Pars.fVeryVerbose = 0;
+        pThData->Pars.fNotVerbose  = 1;
+        pThData->Pars.fSilent      = 1;
+        pThData->Pars.fDumpInv     = 0;
+        pThData->Pars.RunId        = RunId;
+        pThData->Pars.pFuncStop    = Pdr_ManParCallBackToStop;
+        // diversify the threads
+        pThData->Pars.nRandomSeed  = pPars->nRandomSeed + i;
+        pThData->Pars.fFlopOrder  ^= (i & 1);
+        pThData->Pars.fTwoRounds  ^= ((i >> 1) & 1);
+        pThData->Pars.fSkipDown   ^= ((i >> 2) & 1);
+        pThData->pAig              = Aig_ManDupSimple( pAig );
+        pThData->pMan              = Pdr_ManStart( pThData->pAig, &pThData->Pars, NULL );
+        if ( pPars->pPoolRead )
+            pThData->pMan->vPoolCands = IPdr_ManReadPool( pThData->pMan, pPars->pPoolRead );
+        pThData->pMan->pDb         = pDb;
+        pThData->pMan->iDbId       = i;
+        pThData->pDb               = pDb;
+        pThData->Id                = i;
+        pThData->RetValue          = -1;
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManSolveParThread, (void *)pThData );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+        if ( ThData[i].RetValue != -1 )
+            iWinner = i, RetValue = ThData[i].RetValue;
+    }
+    // transfer the results
+    pPars->iFrame = -1;
+    for ( i = 0; i < nProcs; i++ )
+        pPars->iFrame = Abc_MaxInt( pPars->iFrame, ThData[i].Pars.iFrame );
+    if ( iWinner >= 0 )
+    {
+        Pdr_Man_t * p = ThData[iWinner].pMan;
+        pPars->iFrame = ThData[iWinner].Pars.iFrame;
+        if ( RetValue == 0 )
+        {
+            assert( ThData[iWinner].pAig->pSeqModel != NULL );
+            pAig->pSeqModel = ThData[iWinner].pAig->pSeqModel;
+            ThData[iWinner].pAig->pSeqModel = NULL;
+        }
+        else if ( RetValue == 1 && !pPars->fSilent )
+        {
+            Pdr_ManReportInvariant( p );
+            Pdr_ManVerifyInvariant( p );
+        }
+        if ( pPars->fDumpInv )
+        {
+            char * pFileName = pPars->pInvFileName ? pPars->pInvFileName : Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+            Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+            Pdr_ManDumpClauses( p, pFileName, RetValue==1 );
+            printf( "Dumped inductive invariant in file \"%s\".\n", pFileName );
+        }
+        else if ( RetValue == 1 )
+            Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
+    }
+    else if ( !pPars->fSilent )
+    {
+        if ( pPars->nTimeOut && Abc_Clock() > clk + pPars->nTimeOut * CLOCKS_PER_SEC )
+            Abc_Print( 1, "Reached timeout (%d seconds) in frame %d.\n",  pPars->nTimeOut, pPars->iFrame );
+        else if ( pPars->nFrameMax && pPars->iFrame >= pPars->nFrameMax )
+            Abc_Print( 1, "Reached limit on the number of timeframes (%d).\n", pPars->nFrameMax );
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Pdr_Man_t * p = ThData[i].pMan;
+            Abc_Print( 1, "Thread %2d : Frames = %3d  Clauses = %7d  Imported = %7d  SAT calls = %8d  %s\n",
+                i, ThData[i].Pars.iFrame, p->nCubes, p->nDbImports, p->nCalls, i == iWinner ? "(solved)" : "" );
+        }
+        Abc_Print( 1, "Shared %d clauses using %d threads.  ", pDb->nClauses, nProcs );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // save the clauses of the thread that solved the problem or went the furthest
+    if ( pPars->pPoolWrite )
+    {
+        int iBest = iWinner;
+        if ( iBest == -1 )
+            for ( iBest = i = 0; i < nProcs; i++ )
+                if ( ThData[iBest].Pars.iFrame < ThData[i].Pars.iFrame )
+                    iBest = i;
+        ThData[iBest].Pars.fSilent = pPars->fSilent;
+        IPdr_ManWritePool( ThData[iBest].pMan, pPars->pPoolWrite );
+    }
+    // cleanup
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Pdr_ManStop( ThData[i].pMan );
+        Aig_ManStop( ThData[i].pAig );
+    }
+    Vec_IntFree( pDb->vLog );
+    pthread_mutex_destroy( &pDb->Mutex );
+    pPars->iFrame--;
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -113,6 +113,9 @@ struct Ssw_RarPars_t_
     int              nSolved;
     Abc_Cex_t *      pCex;
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
+    int              nProcs;        // the number of threads
+    int              RunId;         // the id of this run
+    int(*pFuncStop)(int);           // called to check if the run should stop
 };
 
 typedef struct Ssw_Sml_t_ Ssw_Sml_t; // sequential simulation manager
@@ -149,6 +152,8 @@ extern int           Ssw_SecGeneralMiter( Aig_Man_t * pMiter, Ssw_Pars_t * pPars
 extern void          Ssw_RarSetDefaultParams( Ssw_RarPars_t * p );
 extern int           Ssw_RarSignalFilter( Aig_Man_t * pAig, Ssw_RarPars_t * pPars );
 extern int           Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars );
+/*=== sswRarPar.c ===================================================*/
+extern int           Ssw_RarSimulatePar( Aig_Man_t * pAig, Ssw_RarPars_t * pPars );
 /*=== sswSim.c ===================================================*/
 extern Ssw_Sml_t *   Ssw_SmlSimulateComb( Aig_Man_t * pAig, int nWords );
 extern Ssw_Sml_t *   Ssw_SmlSimulateSeq( Aig_Man_t * pAig, int nPref, int nFrames, int nWords );
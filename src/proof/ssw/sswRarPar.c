@@ -0,0 +1,208 @@
+/**CFile****************************************************************
+
+  FileName    [sswRarPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Inductive prover with constraints.]
+
+  Synopsis    [Concurrent rarity simulation.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "sswInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Ssw_RarSimulatePar( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
+{
+    return Ssw_RarSimulate( pAig, pPars );
+}
+
+#else // pthreads are used
+
+#define SSW_RAR_THR_MAX  100     // the max number of threads
+#define SSW_RAR_VEC       8      // the number of words in one vector (512 bits)
+
+// information given to the thread
+typedef struct Ssw_RarThData_t_ Ssw_RarThData_t;
+struct Ssw_RarThData_t_
+{
+    Ssw_RarPars_t    Pars;       // parameters of this thread
+    Aig_Man_t *      pAig;       // copy of the user's AIG
+    int              RetValue;   // the result
+    abctime          Time;       // the runtime
+};
+
+// the number of the last run; threads of the earlier runs are stopped
+static volatile int g_nRarRunIds = 0;
+static pthread_mutex_t g_RarMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// call back procedure for the threads
+static int Ssw_RarParCallBackToStop( int RunId ) { return RunId < g_nRarRunIds; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Ssw_RarSimulateParThread( void * pArg )
+{
+    Ssw_RarThData_t * pThData = (Ssw_RarThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    int status;
+    pThData->RetValue = Ssw_RarSimulate( pThData->pAig, &pThData->Pars );
+    pThData->Time = Abc_Clock() - clk;
+    // the first thread to assert an output stops the others
+    if ( pThData->RetValue == 0 )
+    {
+        status = pthread_mutex_lock( &g_RarMutex );  assert( status == 0 );
+        if ( pThData->Pars.RunId == g_nRarRunIds )
+            g_nRarRunIds++;
+        else // another thread has finished first
+            pThData->RetValue = -1;
+        status = pthread_mutex_unlock( &g_RarMutex );  assert( status == 0 );
+    }
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rarity simulation using several threads.]
+
+  Description [The threads use random seeds spread over the seed range,
+  so that the restarts of one thread do not repeat the seeds of another.
+  The odd threads select the rare states twice less often, by simulating
+  twice as many frames in each round. The number of words is rounded up
+  to whole 512-bit vectors. The first thread to assert an output stops
+  the others. Returns 0 if an output is asserted, -1 otherwise.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_RarSimulatePar( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
+{
+    Ssw_RarThData_t ThData[SSW_RAR_THR_MAX];
+    pthread_t WorkerThread[SSW_RAR_THR_MAX];
+    int i, status, RunId, iWinner = -1, RetValue = -1;
+    int nProcs = Abc_MinInt( pPars->nProcs, SSW_RAR_THR_MAX );
+    int nWords = (Abc_MaxInt(pPars->nWords, 1) + SSW_RAR_VEC - 1) / SSW_RAR_VEC * SSW_RAR_VEC;
+    abctime clk = Abc_Clock();
+    // solving all outputs and saving the last state are done by one thread
+    if ( nProcs < 2 || pPars->fSolveAll || pPars->fSetLastState )
+        return Ssw_RarSimulate( pAig, pPars );
+    ABC_FREE( pAig->pSeqModel );
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Rarity simulation with %d threads, %d words, %d frames, %d rounds, %d restart, %d seed, and %d sec timeout.\n",
+            nProcs, nWords, pPars->nFrames, pPars->nRounds, pPars->nRestart, pPars->nRandSeed, pPars->TimeOut );
+    status = pthread_mutex_lock( &g_RarMutex );  assert( status == 0 );
+    RunId = ++g_nRarRunIds;
+    status = pthread_mutex_unlock( &g_RarMutex );  assert( status == 0 );
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Ssw_RarThData_t * pThData = ThData + i;
+        pThData->Pars              = *pPars;
+        pThData->Pars.nProcs       = 0;
+        pThData->Pars.fVerbose     = 0;
+        pThData->Pars.fNotVerbose  = 1;
+        pThData->Pars.fSilent      = 1;
+        pThData->Pars.RunId        = RunId;
+        pThData->Pars.pFuncStop    = Ssw_RarParCallBackToStop;
+        pThData->Pars.nWords       = nWords;
+        // diversify the threads
+        pThData->Pars.nRandSeed    = (pPars->nRandSeed + i * 1000 / nProcs) % 1000;
+        if ( i & 1 )
+        {
+            pThData->Pars.nFrames *= 2;
+            pThData->Pars.nRounds  = (pPars->nRounds + 1) / 2;
+            pThData->Pars.nRestart = (pPars->nRestart + 1) / 2;
+        }
+        pThData->pAig              = Aig_ManDupSimple( pAig );
+        pThData->RetValue          = -1;
+        pThData->Time              = 0;
+        status = pthread_create( WorkerThread + i, NULL, Ssw_RarSimulateParThread, (void *)pThData );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );
+        assert( status == 0 );
+        if ( ThData[i].RetValue == 0 )
+            iWinner = i, RetValue = 0;
+    }
+    // transfer the results
+    if ( iWinner >= 0 )
+    {
+        pAig->pSeqModel = ThData[iWinner].pAig->pSeqModel;
+        ThData[iWinner].pAig->pSeqModel = NULL;
+        pPars->nSolved = ThData[iWinner].Pars.nSolved;
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Abc_Print( 1, "Thread %2d : Seed = %3d  Frames = %3d  Words = %3d  ", i,
+                ThData[i].Pars.nRandSeed, ThData[i].Pars.nFrames, ThData[i].Pars.nWords );
+            Abc_PrintTime( 1, "Time", ThData[i].Time );
+        }
+    }
+    if ( !pPars->fSilent )
+    {
+        if ( iWinner >= 0 )
+            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d by thread %d.  ", pAig->pSeqModel->iPo, pAig->pName, pAig->pSeqModel->iFrame, iWinner );
+        else
+            Abc_Print( 1, "Simulation with %d threads did not assert POs.  ", nProcs );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // cleanup
+    for ( i = 0; i < nProcs; i++ )
+        Aig_ManStop( ThData[i].pAig );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -22,6 +22,7 @@
 #include "aig/gia/giaAig.h"
 #include "base/main/main.h"
 #include "sat/bmc/bmc.h"
+#include "misc/util/utilTruth.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -115,6 +116,7 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
     p->fSetLastState =   0;
     p->fVerbose      =   0;
     p->fNotVerbose   =   0;
+    p->nProcs        =   1;
 }
 
 /**Function*************************************************************
@@ -461,12 +463,7 @@ void Ssw_RarManInitialize( Ssw_RarMan_t * p, Vec_Int_t * vInit )
 int Ssw_RarManPoIsConst0( void * pMan, Aig_Obj_t * pObj )
 {
     Ssw_RarMan_t * p = (Ssw_RarMan_t *)pMan;
-    word * pSim = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
-    int w;
-    for ( w = 0; w < p->pPars->nWords; w++ )
-        if ( pSim[w] )
-            return 0;
-    return 1;
+    return Abc_TtIsConst0( Ssw_RarObjSim( p, Aig_ObjId(pObj) ), p->pPars->nWords );
 }
 
 /**Function*************************************************************
@@ -652,8 +649,7 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
 {
     Aig_Obj_t * pObj, * pRepr;
     word * pSim, * pSim0, * pSim1;
-    word Flip, Flip0, Flip1;
-    int w, i;
+    int i;
     // initialize
     Ssw_RarManInitialize( p, vInit );
     Vec_PtrClear( p->vUpdConst );
@@ -683,11 +679,7 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
         pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
         pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
         pSim1 = Ssw_RarObjSim( p, Aig_ObjFaninId1(pObj) );
-        Flip0 = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
-        Flip1 = Aig_ObjFaninC1(pObj) ? ~(word)0 : 0;
-        for ( w = 0; w < p->pPars->nWords; w++ )
-            pSim[w] = (Flip0 ^ pSim0[w]) & (Flip1 ^ pSim1[w]);
-
+        Abc_TtAndCompl( pSim, pSim0, Aig_ObjFaninC0(pObj), pSim1, Aig_ObjFaninC1(pObj), p->pPars->nWords );
 
         if ( !fUpdate )
             continue;
@@ -711,9 +703,7 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
     {
         pSim  = Ssw_RarObjSim( p, Aig_ObjId(pObj) );
         pSim0 = Ssw_RarObjSim( p, Aig_ObjFaninId0(pObj) );
-        Flip  = Aig_ObjFaninC0(pObj) ? ~(word)0 : 0;
-        for ( w = 0; w < p->pPars->nWords; w++ )
-            pSim[w] = Flip ^ pSim0[w];
+        Abc_TtCopy( pSim, pSim0, p->pPars->nWords, Aig_ObjFaninC0(pObj) );
     }
     // refine classes
     if ( fUpdate )
@@ -1074,6 +1064,9 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
             // check if all outputs are solved by now
             if ( pPars->fSolveAll && p->vCexes && Vec_PtrCountZero(p->vCexes) == 0 )
                 goto finish;
+            // check if another thread has asserted an output
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+                goto finish;
         }
         // get initialization patterns
         if ( pPars->nRestart && r == pPars->nRestart )
@@ -1199,7 +1192,10 @@ int Ssw_RarSimulateGia( Gia_Man_t * p, Ssw_RarPars_t * pPars )
     }
     else
         pAig = Gia_ManToAigSimple( p );
-    RetValue = Ssw_RarSimulate( pAig, pPars );
+    if ( pPars->nProcs > 1 )
+        RetValue = Ssw_RarSimulatePar( pAig, pPars );
+    else
+        RetValue = Ssw_RarSimulate( pAig, pPars );
     // save counter-example
     Abc_CexFree( p->pCexSeq );
     p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -149,6 +149,7 @@ struct Bmc_AndPar_t_
     int         fUseOldCnf;     // use old CNF construction
     int         fUseGlucose;    // use Glucose 3.0 as the default solver
     int         fUseEliminate;  // use variable elimination
+    int         fUsePortfolio;  // use portfolio of solvers on different timeframes
     int         fVerbose;       // verbose 
     int         fVeryVerbose;   // very verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
@@ -206,6 +207,17 @@ struct Bmc_ParFf_t_
     int        fVerbose;
 };
 
+// unified interface to the incremental SAT solvers
+typedef enum { 
+    BMC_SAT_BSAT = 0,              // 0: MiniSat-based bsat
+    BMC_SAT_SATOKO,                // 1: Satoko
+    BMC_SAT_GLUCOSE,               // 2: Glucose 3.0 (glucose2)
+    BMC_SAT_NUM                    // 3: the number of solver types
+} Bmc_SatType_t;
+
+typedef struct Bmc_Sat_t_      Bmc_Sat_t;       // incremental SAT solver
+typedef struct Bmc_SatShare_t_ Bmc_SatShare_t;  // learned clause exchange
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -245,6 +257,34 @@ extern int               Bmc_CexVerifyAnyPo( Gia_Man_t * p, Abc_Cex_t * pCex, Ab
 /*=== bmcICheck.c ==========================================================*/
 extern void              Bmc_PerformICheck( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose );
 extern Vec_Int_t *       Bmc_PerformISearch( Gia_Man_t * p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose );
+/*=== bmcSat.c ==========================================================*/
+extern char *            Bmc_SatTypeName( int Type );
+extern int               Bmc_SatTypeFromName( char * pName );
+extern Bmc_Sat_t *       Bmc_SatStart( int Type );
+extern void              Bmc_SatStop( Bmc_Sat_t * p );
+extern int               Bmc_SatType( Bmc_Sat_t * p );
+extern void *            Bmc_SatSolver( Bmc_Sat_t * p );
+extern void              Bmc_SatSetNVars( Bmc_Sat_t * p, int nVars );
+extern int               Bmc_SatAddVar( Bmc_Sat_t * p );
+extern int               Bmc_SatAddClause( Bmc_Sat_t * p, int * pLits, int nLits );
+extern int               Bmc_SatSolve( Bmc_Sat_t * p, int * pLits, int nLits );
+extern int               Bmc_SatVarValue( Bmc_Sat_t * p, int iVar );
+extern int               Bmc_SatFinal( Bmc_Sat_t * p, int ** ppLits );
+extern void              Bmc_SatSetConfLimit( Bmc_Sat_t * p, int nConfLimit );
+extern void              Bmc_SatSetRuntimeLimit( Bmc_Sat_t * p, abctime nTimeToStop );
+extern void              Bmc_SatSetStop( Bmc_Sat_t * p, int * pStop );
+extern int               Bmc_SatVarNum( Bmc_Sat_t * p );
+extern int               Bmc_SatClauseNum( Bmc_Sat_t * p );
+extern int               Bmc_SatLearntNum( Bmc_Sat_t * p );
+extern int               Bmc_SatConflictNum( Bmc_Sat_t * p );
+extern void              Bmc_SatPrintStats( Bmc_Sat_t * p );
+extern Bmc_SatShare_t *  Bmc_SatShareStart( int nLitsMax, int nLogMax );
+extern void              Bmc_SatShareStop( Bmc_SatShare_t * p );
+extern void              Bmc_SatShareConnect( Bmc_Sat_t * p, Bmc_SatShare_t * pShare );
+extern void              Bmc_SatShareClause( Bmc_Sat_t * p, int * pLits, int nLits );
+extern void              Bmc_SatShareFlush( Bmc_Sat_t * p );
+extern void              Bmc_SatShareImport( Bmc_Sat_t * p );
+extern int               Bmc_SatShareNum( Bmc_SatShare_t * p );
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t *       Unr_ManUnrollStart( Gia_Man_t * pGia, int fVerbose );
 extern Gia_Man_t *       Unr_ManUnrollFrame( Unr_Man_t * p, int f );
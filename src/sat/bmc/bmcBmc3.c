@@ -767,6 +767,7 @@ Gia_ManBmc_t * Saig_Bmc3ManStart( Aig_Man_t * pAig, int nTimeOutOne, int nConfLi
     {
         p->pSat  = sat_solver_new();
         sat_solver_setnvars(p->pSat, 1000);
+        sat_solver_set_inprocess(p->pSat, 1);
     }
     Cnf_ReadMsops( &p->pSopSizes, &p->pSops );
     // terminary simulation 
@@ -0,0 +1,615 @@
+/**CFile****************************************************************
+
+  FileName    [bmcBmcP.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Portfolio BMC solving different timeframes concurrently.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/cnf/cnf.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+    #include "../lib/pthread.h"
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Bmcp_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    Abc_Print( 1, "The portfolio BMC requires ABC to be compiled with pthreads.\n" );
+    return -1;
+}
+
+#else // pthreads are used
+
+#define BMCP_THR_MAX     100
+#define BMCP_SHARE_LITS    8       // the largest learned clause to share
+#define BMCP_SHARE_LOG  (1<<24)    // the largest size of the clause log
+
+typedef struct Bmcp_Man_t_ Bmcp_Man_t;
+typedef struct Bmcp_Thr_t_ Bmcp_Thr_t;
+struct Bmcp_Man_t_
+{
+    Bmc_AndPar_t *    pPars;               // parameters
+    Gia_Man_t *       pGia;                // user's AIG
+    // shared facts
+    Bmc_SatShare_t *  pShare;              // learned clause exchange
+    Bmcp_Thr_t *      pThrs;               // thread data
+    // scheduling
+    pthread_mutex_t   Mutex;               // protects the data below
+    Vec_Int_t         vStatus;             // frame status (0 = pending; 1 = proved)
+    Vec_Int_t         vOwner;              // the thread solving each timeframe
+    Vec_Int_t         vCnfVars;            // the number of SAT variables after each timeframe
+    int               iFrameNext;          // the next timeframe to give out
+    int               iFrameLimit;         // timeframes starting from this one are not needed
+    int               iFrameDone;          // timeframes before this one are proved
+    int               iFrameCex;           // the earliest failed timeframe
+    Abc_Cex_t *       pCex;                // the counter-example
+    abctime           clkStart;            // starting time
+    abctime           clkStop;             // timeout
+};
+
+// information given to the thread
+struct Bmcp_Thr_t_
+{
+    Bmcp_Man_t *      pMan;                // shared manager
+    int               iThread;             // thread ID
+    Bmc_Sat_t *       pSat;                // SAT solver
+    int               fStop;               // interrupts the solver
+    // the thread's own unrolling
+    Gia_Man_t *       pFrames;             // unfolded AIG (pFrames->vCopies point to pClean)
+    Gia_Man_t *       pClean;              // incremental AIG (pClean->Value point to pFrames)
+    Vec_Ptr_t         vGia2Fr;             // copies of GIA in each timeframe
+    Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
+    Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
+    Vec_Int_t *       vPoLits;             // output literals of the last timeframe (-1 if constant 0)
+    int               nVars;               // the number of SAT variables used
+    int               nFrames;             // the number of timeframes loaded
+    int               nClauses;            // the number of clauses loaded
+    // statistics
+    int               nSolved;             // the number of timeframes solved
+    abctime           timeUnf;             // runtime of unfolding
+    abctime           timeCnf;             // runtime of CNF generation
+    abctime           timeSat;             // runtime of the solver
+};
+
+static inline int * Bmcp_ThrCopies( Bmcp_Thr_t * p, int f ) { return (int*)Vec_PtrEntry(&p->vGia2Fr, f); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Incremental unfolding.]
+
+  Description [Same as in bmcBmcS.c, but one timeframe at a time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Bmcp_ThrUnfold_rec( Bmcp_Thr_t * p, int iObj, int f )
+{
+    Gia_Man_t * pGia = p->pMan->pGia;
+    Gia_Obj_t * pObj;
+    int iLit = 0, * pCopies = Bmcp_ThrCopies( p, f );
+    if ( pCopies[iObj] >= 0 )
+        return pCopies[iObj];
+    pObj = Gia_ManObj( pGia, iObj );
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        if ( Gia_ObjIsPi(pGia, pObj) )
+        {
+            Vec_IntPushTwo( &p->vCiMap, Gia_ObjCioId(pObj), f );
+            iLit = Gia_ManAppendCi( p->pFrames );
+        }
+        else if ( f > 0 )
+        {
+            pObj = Gia_ObjRoToRi( pGia, pObj );
+            iLit = Bmcp_ThrUnfold_rec( p, Gia_ObjFaninId0p(pGia, pObj), f-1 );
+            iLit = Abc_LitNotCond( iLit, Gia_ObjFaninC0(pObj) );
+        }
+    }
+    else if ( Gia_ObjIsAnd(pObj) )
+    {
+        iLit = Bmcp_ThrUnfold_rec( p, Gia_ObjFaninId0(pObj, iObj), f );
+        iLit = Abc_LitNotCond( iLit, Gia_ObjFaninC0(pObj) );
+        if ( iLit > 0 )
+        {
+            int iNew;
+            iNew = Bmcp_ThrUnfold_rec( p, Gia_ObjFaninId1(pObj, iObj), f );
+            iNew = Abc_LitNotCond( iNew, Gia_ObjFaninC1(pObj) );
+            iLit = Gia_ManHashAnd( p->pFrames, iLit, iNew );
+        }
+    }
+    else assert( 0 );
+    return (pCopies[iObj] = iLit);
+}
+static int Bmcp_ThrCollect_rec( Bmcp_Thr_t * p, int iObj )
+{
+    Gia_Obj_t * pObj;
+    int iSatVar, iLitClean = Gia_ObjCopyArray( p->pFrames, iObj );
+    if ( iLitClean >= 0 )
+        return iLitClean;
+    pObj = Gia_ManObj( p->pFrames, iObj );
+    iSatVar = Vec_IntEntry( &p->vFr2Sat, iObj );
+    if ( iSatVar > 0 || Gia_ObjIsCi(pObj) )
+        iLitClean = Gia_ManAppendCi( p->pClean );
+    else if ( Gia_ObjIsAnd(pObj) )
+    {
+        int iLit0 = Bmcp_ThrCollect_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+        int iLit1 = Bmcp_ThrCollect_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+        iLit0 = Abc_LitNotCond( iLit0, Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( iLit1, Gia_ObjFaninC1(pObj) );
+        iLitClean = Gia_ManAppendAnd( p->pClean, iLit0, iLit1 );
+    }
+    else assert( 0 );
+    assert( !Abc_LitIsCompl(iLitClean) );
+    Gia_ManObj( p->pClean, Abc_Lit2Var(iLitClean) )->Value = iObj;
+    Gia_ObjSetCopyArray( p->pFrames, iObj, iLitClean );
+    return iLitClean;
+}
+static Gia_Man_t * Bmcp_ThrUnfold( Bmcp_Thr_t * p, int f )
+{
+    Gia_Man_t * pGia = p->pMan->pGia;
+    Gia_Man_t * pNew = NULL; Gia_Obj_t * pObj;
+    int i, iLitFrame, iLitClean, fTrivial = 1;
+    int * pCopies, nFrameObjs = Gia_ManObjNum(p->pFrames);
+    assert( Gia_ManPoNum(p->pFrames) == f * Gia_ManPoNum(pGia) );
+    // unfold this timeframe
+    Vec_PtrPush( &p->vGia2Fr, ABC_FALLOC(int, Gia_ManObjNum(pGia)) );
+    assert( Vec_PtrSize(&p->vGia2Fr) == f+1 );
+    pCopies = Bmcp_ThrCopies( p, f );
+    pCopies[0] = 0;
+    Gia_ManForEachPo( pGia, pObj, i )
+    {
+        iLitFrame = Bmcp_ThrUnfold_rec( p, Gia_ObjFaninId0p(pGia, pObj), f );
+        iLitFrame = Abc_LitNotCond( iLitFrame, Gia_ObjFaninC0(pObj) );
+        pCopies[Gia_ObjId(pGia, pObj)] = Gia_ManAppendCo( p->pFrames, iLitFrame );
+        fTrivial &= (iLitFrame == 0);
+    }
+    if ( fTrivial )
+        return NULL;
+    // create a clean copy of the new nodes of this timeframe
+    Vec_IntFillExtra( &p->vFr2Sat, Gia_ManObjNum(p->pFrames), -1 );
+    Vec_IntFillExtra( &p->pFrames->vCopies, Gia_ManObjNum(p->pFrames), -1 );
+    Gia_ManStopP( &p->pClean );
+    p->pClean = Gia_ManStart( Gia_ManObjNum(p->pFrames) - nFrameObjs + 1000 );
+    Gia_ObjSetCopyArray( p->pFrames, 0, 0 );
+    for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
+    {
+        pObj = Gia_ManCo( p->pFrames, f * Gia_ManPoNum(pGia) + i );
+        iLitClean = Bmcp_ThrCollect_rec( p, Gia_ObjFaninId0p(p->pFrames, pObj) );
+        iLitClean = Abc_LitNotCond( iLitClean, Gia_ObjFaninC0(pObj) );
+        iLitClean = Gia_ManAppendCo( p->pClean, iLitClean );
+        Gia_ManObj( p->pClean, Abc_Lit2Var(iLitClean) )->Value = Gia_ObjId(p->pFrames, pObj);
+        Gia_ObjSetCopyArray( p->pFrames, Gia_ObjId(p->pFrames, pObj), iLitClean );
+    }
+    pNew = p->pClean; p->pClean = NULL;
+    Gia_ManForEachObj( pNew, pObj, i )
+        Gia_ObjSetCopyArray( p->pFrames, pObj->Value, -1 );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one more timeframe to the thread's unrolling.]
+
+  Description [Derives the CNF of the new logic and loads it into the
+  thread's solver. The unrolling and the CNF are built in the same way
+  in every thread, so the SAT variables of each object are the same in
+  all solvers and the learned clauses can be exchanged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmcp_ThrAddFrame( Bmcp_Thr_t * p )
+{
+    Gia_Man_t * pGia = p->pMan->pGia;
+    abctime clk = Abc_Clock();
+    int f = p->nFrames;
+    Gia_Man_t * pNew = Bmcp_ThrUnfold( p, f );
+    Cnf_Dat_t * pCnf = NULL;
+    Gia_Obj_t * pObj;
+    int i, iVar, * pMap;
+    p->timeUnf += Abc_Clock() - clk;
+    if ( pNew != NULL )
+    {
+        clk = Abc_Clock();
+        pCnf = (Cnf_Dat_t *) Mf_ManGenerateCnf( pNew, 8, 1, 0, 0, 0 );
+        pMap = ABC_FALLOC( int, Gia_ManObjNum(pNew) );
+        pMap[0] = 0;
+        Gia_ManForEachObj1( pNew, pObj, i )
+        {
+            if ( pCnf->pObj2Count[i] <= 0 && !Gia_ObjIsCi(pObj) )
+                continue;
+            iVar = Vec_IntEntry( &p->vFr2Sat, pObj->Value );
+            if ( iVar == -1 )
+                Vec_IntWriteEntry( &p->vFr2Sat, pObj->Value, (iVar = p->nVars++) );
+            pMap[i] = iVar;
+        }
+        Gia_ManStop( pNew );
+        for ( i = 0; i < pCnf->nLiterals; i++ )
+            pCnf->pClauses[0][i] = Abc_Lit2LitV( pMap, pCnf->pClauses[0][i] );
+        ABC_FREE( pMap );
+        p->timeCnf += Abc_Clock() - clk;
+        // load the clauses
+        Bmc_SatSetNVars( p->pSat, p->nVars );
+        for ( i = 0; i < pCnf->nClauses; i++ )
+            if ( !Bmc_SatAddClause( p->pSat, pCnf->pClauses[i], pCnf->pClauses[i+1]-pCnf->pClauses[i] ) )
+                assert( 0 );
+        p->nClauses += pCnf->nClauses;
+    }
+    Vec_IntClear( p->vPoLits );
+    for ( i = 0; i < Gia_ManPoNum(pGia); i++ )
+    {
+        int iObj = Gia_ObjId( p->pFrames, Gia_ManCo(p->pFrames, f * Gia_ManPoNum(pGia) + i) );
+        Vec_IntPush( p->vPoLits, pCnf ? Abc_Var2Lit(Vec_IntEntry(&p->vFr2Sat, iObj), 0) : -1 );
+    }
+    if ( pCnf )
+        Cnf_DataFree( pCnf );
+    p->nFrames++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates and deletes the manager and the thread data.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Bmcp_Man_t * Bmcp_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    Bmcp_Man_t * p = ABC_CALLOC( Bmcp_Man_t, 1 );
+    int status;
+    assert( Gia_ManRegNum(pGia) > 0 );
+    p->pPars    = pPars;
+    p->pGia     = pGia;
+    p->clkStart = Abc_Clock();
+    p->clkStop  = pPars->nTimeOut ? p->clkStart + (abctime)pPars->nTimeOut * CLOCKS_PER_SEC : 0;
+    p->iFrameLimit = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    p->iFrameCex   = -1;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    return p;
+}
+static void Bmcp_ManStop( Bmcp_Man_t * p )
+{
+    int status;
+    Vec_IntErase( &p->vStatus );
+    Vec_IntErase( &p->vOwner );
+    Vec_IntErase( &p->vCnfVars );
+    Abc_CexFreeP( &p->pCex );
+    status = pthread_mutex_destroy( &p->Mutex );  assert( status == 0 );
+    ABC_FREE( p );
+}
+static void Bmcp_ThrStart( Bmcp_Thr_t * p, Bmcp_Man_t * pMan, int iThread )
+{
+    Gia_Man_t * pGia = pMan->pGia;
+    int Lit = Abc_Var2Lit( 0, 1 );
+    memset( p, 0, sizeof(Bmcp_Thr_t) );
+    p->pMan    = pMan;
+    p->iThread = iThread;
+    p->pSat    = Bmc_SatStart( iThread % BMC_SAT_NUM );
+    p->pFrames = Gia_ManStart( 3*Gia_ManObjNum(pGia) );  Gia_ManHashStart(p->pFrames);
+    Vec_PtrGrow( &p->vGia2Fr, 1000 );
+    Vec_IntGrow( &p->vFr2Sat, 3*Gia_ManCiNum(pGia) );
+    Vec_IntPush( &p->vFr2Sat, 0 );
+    Vec_IntGrow( &p->vCiMap, 3*Gia_ManCiNum(pGia) );
+    p->vPoLits = Vec_IntAlloc( Gia_ManPoNum(pGia) );
+    Bmc_SatSetConfLimit( p->pSat, pMan->pPars->nConfLimit );
+    Bmc_SatSetRuntimeLimit( p->pSat, pMan->clkStop );
+    Bmc_SatSetStop( p->pSat, &p->fStop );
+    Bmc_SatShareConnect( p->pSat, pMan->pShare );
+    // variable 0 is constant 0
+    Bmc_SatSetNVars( p->pSat, 1 );
+    Bmc_SatAddClause( p->pSat, &Lit, 1 );
+    p->nVars   = 1;
+}
+static void Bmcp_ThrStop( Bmcp_Thr_t * p )
+{
+    Bmc_SatStop( p->pSat );
+    Gia_ManStopP( &p->pFrames );
+    Gia_ManStopP( &p->pClean );
+    Vec_PtrFreeData( &p->vGia2Fr );
+    Vec_PtrErase( &p->vGia2Fr );
+    Vec_IntErase( &p->vFr2Sat );
+    Vec_IntErase( &p->vCiMap );
+    Vec_IntFree( p->vPoLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example from the thread's solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Bmcp_ThrGenerateCex( Bmcp_Thr_t * p, int i, int f )
+{
+    Gia_Man_t * pGia = p->pMan->pGia;
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(pGia), Gia_ManPiNum(pGia), Gia_ManPoNum(pGia), f*Gia_ManPoNum(pGia)+i );
+    Gia_Obj_t * pObj;  int k;
+    Gia_ManForEachPi( p->pFrames, pObj, k )
+    {
+        int iSatVar = Vec_IntEntry( &p->vFr2Sat, Gia_ObjId(p->pFrames, pObj) );
+        int iCiId   = Vec_IntEntry( &p->vCiMap, 2*k+0 );
+        int iFrame  = Vec_IntEntry( &p->vCiMap, 2*k+1 );
+        if ( iFrame > f || iSatVar <= 0 )
+            continue;
+        if ( Bmc_SatVarValue(p->pSat, iSatVar) )
+            Abc_InfoSetBit( pCex->pData, Gia_ManRegNum(pGia) + iFrame * Gia_ManPiNum(pGia) + iCiId );
+    }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Interrupts the threads working on the frames not needed.]
+
+  Description [Should be called with the mutex locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmcp_ManSetLimit( Bmcp_Man_t * p, int iFrameLimit )
+{
+    int f;
+    if ( p->iFrameLimit <= iFrameLimit )
+        return;
+    p->iFrameLimit = iFrameLimit;
+    for ( f = iFrameLimit; f < Vec_IntSize(&p->vOwner); f++ )
+        if ( Vec_IntEntry(&p->vOwner, f) >= 0 )
+            p->pThrs[Vec_IntEntry(&p->vOwner, f)].fStop = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records a proved timeframe and prints the progress.]
+
+  Description [Should be called with the mutex locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Bmcp_ManFrameProved( Bmcp_Thr_t * pThr, int f )
+{
+    Bmcp_Man_t * p = pThr->pMan;
+    int i;
+    Vec_IntWriteEntry( &p->vStatus, f, 1 );
+    Vec_IntWriteEntry( &p->vCnfVars, f, pThr->nVars );
+    if ( p->pPars->pFuncOnFrameDone )
+        for ( i = 0; i < Gia_ManPoNum(p->pGia); i++ )
+            p->pPars->pFuncOnFrameDone( f, i, 0 );
+    for ( ; p->iFrameDone < Vec_IntSize(&p->vStatus) && Vec_IntEntry(&p->vStatus, p->iFrameDone); p->iFrameDone++ )
+    {
+        if ( !p->pPars->fVerbose )
+            continue;
+        Abc_Print( 1, "%4d + : ",         p->iFrameDone );
+        Abc_Print( 1, "Var =%8.0f.  ",    (double)Vec_IntEntry(&p->vCnfVars, p->iFrameDone) );
+        Abc_Print( 1, "Shared =%7d.  ",   Bmc_SatShareNum(p->pShare) );
+        Abc_Print( 1, "Frames ahead =%4d.  ", Vec_IntSize(&p->vStatus) - p->iFrameDone - 1 );
+        Abc_Print( 1, "%4.0f MB",         1.0*((int)Gia_ManMemory(pThr->pFrames) + Vec_IntMemory(&pThr->vFr2Sat))/(1<<20) );
+        Abc_Print( 1, "%9.2f sec  ",      (float)(Abc_Clock() - p->clkStart)/(float)(CLOCKS_PER_SEC) );
+        Abc_Print( 1, "\n" );
+        fflush( stdout );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves timeframes given out by the manager.]
+
+  Description [Each thread runs its own solver type and extends its own
+  unrolling up to the timeframe it takes. Only taking a timeframe and
+  recording the result are done with the mutex locked. Timeframes are
+  given out in the increasing order, so that each thread works on the
+  smallest timeframe that nobody is solving.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Bmcp_ThrPerform( void * pArg )
+{
+    Bmcp_Thr_t * pThr = (Bmcp_Thr_t *)pArg;
+    Bmcp_Man_t * p = pThr->pMan;
+    int nPos = Gia_ManPoNum(p->pGia);
+    int f, i, iLit, status;
+    while ( 1 )
+    {
+        // get the next timeframe
+        pthread_mutex_lock( &p->Mutex );
+        if ( p->iFrameNext >= p->iFrameLimit || (p->clkStop && Abc_Clock() > p->clkStop) )
+        {
+            pthread_mutex_unlock( &p->Mutex );
+            break;
+        }
+        f = p->iFrameNext++;
+        Vec_IntFillExtra( &p->vStatus,  f+1, 0 );
+        Vec_IntFillExtra( &p->vOwner,   f+1, -1 );
+        Vec_IntFillExtra( &p->vCnfVars, f+1, 0 );
+        Vec_IntWriteEntry( &p->vOwner, f, pThr->iThread );
+        pThr->fStop = 0;
+        pthread_mutex_unlock( &p->Mutex );
+        // bring the unrolling up to date
+        while ( pThr->nFrames <= f )
+            Bmcp_ThrAddFrame( pThr );
+        // solve the outputs of this timeframe
+        for ( i = 0; i < nPos; i++ )
+        {
+            Abc_Cex_t * pCex = NULL;
+            abctime clk = Abc_Clock();
+            iLit = Vec_IntEntry( pThr->vPoLits, i );
+            if ( iLit == -1 ) // trivially unsat
+                continue;
+            status = Bmc_SatSolve( pThr->pSat, &iLit, 1 );
+            pThr->timeSat += Abc_Clock() - clk;
+            if ( status == -1 ) // the negation of the proved output is implied by the unrolling
+            {
+                iLit = Abc_LitNot( iLit );
+                Bmc_SatAddClause( pThr->pSat, &iLit, 1 );
+                Bmc_SatShareClause( pThr->pSat, &iLit, 1 );
+                Bmc_SatShareFlush( pThr->pSat );
+            }
+            else if ( status == 1 )
+                pCex = Bmcp_ThrGenerateCex( pThr, i, f );
+            pthread_mutex_lock( &p->Mutex );
+            if ( pCex && (p->iFrameCex == -1 || f < p->iFrameCex) )
+            {
+                Abc_CexFreeP( &p->pCex );
+                p->pCex = pCex; pCex = NULL;
+                p->iFrameCex = f;
+                if ( p->pPars->fVerbose )
+                    Abc_Print( 1, "Thread %d (%s) found a counter-example in frame %d.\n", pThr->iThread, Bmc_SatTypeName(Bmc_SatType(pThr->pSat)), f );
+            }
+            if ( status != -1 ) // the later timeframes are not needed
+                Bmcp_ManSetLimit( p, f + (status == 1) );
+            pthread_mutex_unlock( &p->Mutex );
+            Abc_CexFreeP( &pCex );
+            if ( status != -1 )
+                break;
+        }
+        pthread_mutex_lock( &p->Mutex );
+        Vec_IntWriteEntry( &p->vOwner, f, -1 );
+        if ( i == nPos )
+        {
+            Bmcp_ManFrameProved( pThr, f );
+            pThr->nSolved++;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Portfolio BMC.]
+
+  Description [Each thread builds its own unrolling and its CNF, takes
+  timeframes dynamically and solves them with its own solver (bsat,
+  satoko, and glucose2 in the round-robin order). The negations of the
+  proved outputs and the short learned clauses are shared among the
+  threads. If a counter-example is found, the timeframes after it are
+  abandoned, while the earlier ones are finished, so that the shallowest
+  counter-example is reported.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmcp_ManPerform( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
+{
+    pthread_t WorkerThread[BMCP_THR_MAX];
+    Bmcp_Thr_t ThData[BMCP_THR_MAX];
+    Bmcp_Man_t * p;
+    int i, status, RetValue = -1;
+    int nProcs = Abc_MinInt( Abc_MaxInt(pPars->nProcs, 1), BMCP_THR_MAX );
+    abctime timeUnf = 0, timeCnf = 0, timeSat = 0;
+    Abc_CexFreeP( &pGia->pCexSeq );
+    p = Bmcp_ManStart( pGia, pPars );
+    p->pThrs  = ThData;
+    p->pShare = Bmc_SatShareStart( BMCP_SHARE_LITS, BMCP_SHARE_LOG );
+    // start the threads
+    for ( i = 0; i < nProcs; i++ )
+        Bmcp_ThrStart( ThData + i, p, i );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Bmcp_ThrPerform, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    // report the results
+    if ( p->pCex )
+    {
+        RetValue = 0;
+        pPars->iFrame = p->iFrameCex;
+        pPars->nFailOuts++;
+        pGia->pCexSeq = p->pCex; p->pCex = NULL;
+        if ( !pPars->fNotVerbose )
+        {
+            int nOutDigits = Abc_Base10Log( Gia_ManPoNum(pGia) );
+            Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).  ",
+                nOutDigits, pGia->pCexSeq->iPo, pGia->pCexSeq->iFrame, nOutDigits, pPars->nFailOuts, nOutDigits, Gia_ManPoNum(pGia) );
+            fflush( stdout );
+        }
+    }
+    else
+    {
+        pPars->iFrame = p->iFrameDone - 1;
+        // like &bmcs, count the timeframe that was not finished, if any
+        if ( !pPars->fNotVerbose )
+            printf( "No output failed in %d frames.  ", p->iFrameDone + (!pPars->nFramesMax || p->iFrameDone < pPars->nFramesMax) );
+    }
+    Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            Abc_Print( 1, "Thread %2d : Frames = %5d.  Clauses = %9d.  ", i, ThData[i].nSolved, ThData[i].nClauses );
+            Abc_PrintTime( 1, "SAT time", ThData[i].timeSat );
+            Bmc_SatPrintStats( ThData[i].pSat );
+            timeUnf += ThData[i].timeUnf;
+            timeCnf += ThData[i].timeCnf;
+            timeSat += ThData[i].timeSat;
+        }
+        Abc_Print( 1, "Shared clauses = %d.\n", Bmc_SatShareNum(p->pShare) );
+        ABC_PRT( "Unfolding (all)", timeUnf );
+        ABC_PRT( "CNF (all)      ", timeCnf );
+        ABC_PRT( "SAT (all)      ", timeSat );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        Bmcp_ThrStop( ThData + i );
+    Bmc_SatShareStop( p->pShare );
+    Bmcp_ManStop( p );
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,501 @@
+/**CFile****************************************************************
+
+  FileName    [bmcSat.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Unified interface to the incremental SAT solvers.]
+
+  Author      [agent <agent@local>]
+
+  Date        [Started - October 2026]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose2/AbcGlucose2.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+    #include "../lib/pthread.h"
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// learned clause exchange shared by several solvers
+struct Bmc_SatShare_t_
+{
+    int               nLitsMax;            // the largest clause to share
+    int               nLogMax;             // the largest number of entries in the log
+    int               nSolvers;            // the number of connected solvers
+    int               nClauses;            // the number of clauses in the log
+    Vec_Int_t         vLog;                // clauses as <source> <size> <lit0> <lit1> ...
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t   Mutex;               // protects the log
+#endif
+};
+
+// one incremental solver
+struct Bmc_Sat_t_
+{
+    int               Type;                // solver type
+    void *            pSat;                // solver
+    int               nConfLimit;          // conflict limit per call
+    Vec_Int_t *       vTemp;               // temporary clause
+    // clause sharing
+    Bmc_SatShare_t *  pShare;              // clause exchange (or NULL)
+    int               iShareId;            // the ID of this solver in the exchange
+    int               iShareNext;          // the next log entry to import
+    Vec_Int_t *       vExport;             // clauses to export as <size> <lit0> <lit1> ...
+    Vec_Int_t *       vImport;             // clauses to import
+    int               nExported;           // the number of exported clauses
+    int               nImported;           // the number of imported clauses
+};
+
+static char * s_BmcSatNames[BMC_SAT_NUM] = { "bsat", "satoko", "glucose2" };
+
+#define BMC_SAT_EXPORT_MAX (1<<16)         // the number of entries queued for export before a flush
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Solver type names.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Bmc_SatTypeName( int Type )
+{
+    assert( Type >= 0 && Type < BMC_SAT_NUM );
+    return s_BmcSatNames[Type];
+}
+int Bmc_SatTypeFromName( char * pName )
+{
+    int i;
+    for ( i = 0; i < BMC_SAT_NUM; i++ )
+        if ( !strcmp(pName, s_BmcSatNames[i]) )
+            return i;
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starting and stopping the solver.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_Sat_t * Bmc_SatStart( int Type )
+{
+    Bmc_Sat_t * p = ABC_CALLOC( Bmc_Sat_t, 1 );
+    p->Type  = Type;
+    p->vTemp = Vec_IntAlloc( 100 );
+    if ( Type == BMC_SAT_BSAT )
+        p->pSat = sat_solver_new();
+    else if ( Type == BMC_SAT_SATOKO )
+        p->pSat = satoko_create();
+    else if ( Type == BMC_SAT_GLUCOSE )
+        p->pSat = bmcg2_sat_solver_start();
+    else assert( 0 );
+    return p;
+}
+void Bmc_SatStop( Bmc_Sat_t * p )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_delete( (sat_solver *)p->pSat );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        satoko_destroy( (satoko_t *)p->pSat );
+    else if ( p->Type == BMC_SAT_GLUCOSE )
+        bmcg2_sat_solver_stop( (bmcg2_sat_solver *)p->pSat );
+    Vec_IntFreeP( &p->vExport );
+    Vec_IntFreeP( &p->vImport );
+    Vec_IntFree( p->vTemp );
+    ABC_FREE( p );
+}
+int Bmc_SatType( Bmc_Sat_t * p )
+{
+    return p->Type;
+}
+void * Bmc_SatSolver( Bmc_Sat_t * p )
+{
+    return p->pSat;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adding variables and clauses.]
+
+  Description [The literals are copied, so the array is not changed.
+  Returns 0 if the problem is found to be UNSAT.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SatSetNVars( Bmc_Sat_t * p, int nVars )
+{
+    int i;
+    if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_setnvars( (sat_solver *)p->pSat, nVars );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        for ( i = satoko_varnum((satoko_t *)p->pSat); i < nVars; i++ )
+            satoko_add_variable( (satoko_t *)p->pSat, 0 );
+    else if ( p->Type == BMC_SAT_GLUCOSE )
+        for ( i = bmcg2_sat_solver_varnum((bmcg2_sat_solver *)p->pSat); i < nVars; i++ )
+            bmcg2_sat_solver_addvar( (bmcg2_sat_solver *)p->pSat );
+}
+int Bmc_SatAddVar( Bmc_Sat_t * p )
+{
+    int iVar = Bmc_SatVarNum( p );
+    Bmc_SatSetNVars( p, iVar + 1 );
+    return iVar;
+}
+int Bmc_SatAddClause( Bmc_Sat_t * p, int * pLits, int nLits )
+{
+    Vec_IntClear( p->vTemp );
+    Vec_IntPushArray( p->vTemp, pLits, nLits );
+    pLits = Vec_IntArray( p->vTemp );
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_addclause( (sat_solver *)p->pSat, pLits, pLits + nLits );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_add_clause( (satoko_t *)p->pSat, pLits, nLits ) == SATOKO_OK;
+    if ( p->Type == BMC_SAT_GLUCOSE )
+        return bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)p->pSat, pLits, nLits );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solving under assumptions.]
+
+  Description [Returns 1 (SAT), -1 (UNSAT), or 0 (undecided). If the
+  solver is connected to a clause exchange, the clauses shared by other
+  solvers are imported before solving, while the short clauses learned
+  by this solver are exported after solving.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatSolve( Bmc_Sat_t * p, int * pLits, int nLits )
+{
+    int status = 0;
+    if ( p->pShare )
+        Bmc_SatShareImport( p );
+    if ( p->Type == BMC_SAT_BSAT )
+    {
+        status = sat_solver_solve( (sat_solver *)p->pSat, pLits, pLits + nLits, (ABC_INT64_T)p->nConfLimit, 0, 0, 0 );
+        status = status == l_True ? 1 : status == l_False ? -1 : 0;
+    }
+    else if ( p->Type == BMC_SAT_SATOKO )
+    {
+        status = satoko_solve_assumptions_limit( (satoko_t *)p->pSat, pLits, nLits, p->nConfLimit );
+        status = status == SATOKO_SAT ? 1 : status == SATOKO_UNSAT ? -1 : 0;
+    }
+    else if ( p->Type == BMC_SAT_GLUCOSE )
+    {
+        bmcg2_sat_solver_set_conflict_budget( (bmcg2_sat_solver *)p->pSat, p->nConfLimit );
+        status = bmcg2_sat_solver_solve( (bmcg2_sat_solver *)p->pSat, pLits, nLits );
+    }
+    if ( p->pShare )
+        Bmc_SatShareFlush( p );
+    return status;
+}
+int Bmc_SatVarValue( Bmc_Sat_t * p, int iVar )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_var_value( (sat_solver *)p->pSat, iVar );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_read_cex_varvalue( (satoko_t *)p->pSat, iVar );
+    if ( p->Type == BMC_SAT_GLUCOSE )
+        return bmcg2_sat_solver_read_cex_varvalue( (bmcg2_sat_solver *)p->pSat, iVar );
+    return 0;
+}
+// returns the complemented assumptions participating in the proof of UNSAT
+int Bmc_SatFinal( Bmc_Sat_t * p, int ** ppLits )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_final( (sat_solver *)p->pSat, ppLits );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_final_conflict( (satoko_t *)p->pSat, ppLits );
+    if ( p->Type == BMC_SAT_GLUCOSE )
+        return bmcg2_sat_solver_final( (bmcg2_sat_solver *)p->pSat, ppLits );
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resource limits.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_SatSetConfLimit( Bmc_Sat_t * p, int nConfLimit )
+{
+    p->nConfLimit = nConfLimit;
+}
+void Bmc_SatSetRuntimeLimit( Bmc_Sat_t * p, abctime nTimeToStop )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_set_runtime_limit( (sat_solver *)p->pSat, nTimeToStop );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        satoko_set_runtime_limit( (satoko_t *)p->pSat, nTimeToStop );
+    else if ( p->Type == BMC_SAT_GLUCOSE )
+        bmcg2_sat_solver_set_runtime_limit( (bmcg2_sat_solver *)p->pSat, nTimeToStop );
+}
+void Bmc_SatSetStop( Bmc_Sat_t * p, int * pStop )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_set_stop( (sat_solver *)p->pSat, pStop );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        satoko_set_stop( (satoko_t *)p->pSat, pStop );
+    else if ( p->Type == BMC_SAT_GLUCOSE )
+        bmcg2_sat_solver_set_stop( (bmcg2_sat_solver *)p->pSat, pStop );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_SatVarNum( Bmc_Sat_t * p )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_nvars( (sat_solver *)p->pSat );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_varnum( (satoko_t *)p->pSat );
+    if ( p->Type == BMC_SAT_GLUCOSE )
+        return bmcg2_sat_solver_varnum( (bmcg2_sat_solver *)p->pSat );
+    return 0;
+}
+int Bmc_SatClauseNum( Bmc_Sat_t * p )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_nclauses( (sat_solver *)p->pSat );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_clausenum( (satoko_t *)p->pSat );
+    if ( p->Type == BMC_SAT_GLUCOSE )
+        return bmcg2_sat_solver_clausenum( (bmcg2_sat_solver *)p->pSat );
+    return 0;
+}
+int Bmc_SatLearntNum( Bmc_Sat_t * p )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        return Sat_MemEntryNum( &((sat_solver *)p->pSat)->Mem, 1 );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_learntnum( (satoko_t *)p->pSat );
+    if ( p->Type == BMC_SAT_GLUCOSE )
+        return bmcg2_sat_solver_learntnum( (bmcg2_sat_solver *)p->pSat );
+    return 0;
+}
+int Bmc_SatConflictNum( Bmc_Sat_t * p )
+{
+    if ( p->Type == BMC_SAT_BSAT )
+        return sat_solver_nconflicts( (sat_solver *)p->pSat );
+    if ( p->Type == BMC_SAT_SATOKO )
+        return satoko_conflictnum( (satoko_t *)p->pSat );
+    if ( p->Type == BMC_SAT_GLUCOSE )
+        return bmcg2_sat_solver_conflictnum( (bmcg2_sat_solver *)p->pSat );
+    return 0;
+}
+void Bmc_SatPrintStats( Bmc_Sat_t * p )
+{
+    Abc_Print( 1, "%-8s : ",         Bmc_SatTypeName(p->Type) );
+    Abc_Print( 1, "Var =%8d  ",      Bmc_SatVarNum(p) );
+    Abc_Print( 1, "Cla =%9d  ",      Bmc_SatClauseNum(p) );
+    Abc_Print( 1, "Learnt =%8d  ",   Bmc_SatLearntNum(p) );
+    Abc_Print( 1, "Conf =%9d  ",     Bmc_SatConflictNum(p) );
+    if ( p->pShare )
+        Abc_Print( 1, "Export =%7d  Import =%7d", p->nExported, p->nImported );
+    Abc_Print( 1, "\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Learned clause exchange.]
+
+  Description [The solvers connected to the same exchange should be
+  loaded with the same clauses, or each solver's clauses should be a
+  conservative extension of the other solvers' clauses (for example,
+  the CNF of different numbers of timeframes of the same unrolling).
+  The learned clauses are then implied by the clauses of every solver,
+  while the clauses with variables unknown to the importing solver are
+  postponed until these variables are added. Each solver should be used
+  by one thread, while the exchange can be shared by several threads.
+  Clauses are collected while solving and published after solving,
+  which keeps locking out of the solvers' inner loops. A long call also
+  publishes them whenever BMC_SAT_EXPORT_MAX entries are queued, so the
+  queue stays bounded. When the log reaches its size limit, no more
+  clauses are published.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_SatShare_t * Bmc_SatShareStart( int nLitsMax, int nLogMax )
+{
+    Bmc_SatShare_t * p = ABC_CALLOC( Bmc_SatShare_t, 1 );
+    p->nLitsMax = nLitsMax;
+    p->nLogMax  = nLogMax;
+    Vec_IntGrow( &p->vLog, 1000 );
+#ifdef ABC_USE_PTHREADS
+    {
+        int status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+    }
+#endif
+    return p;
+}
+void Bmc_SatShareStop( Bmc_SatShare_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    {
+        int status = pthread_mutex_destroy( &p->Mutex );  assert( status == 0 );
+    }
+#endif
+    Vec_IntErase( &p->vLog );
+    ABC_FREE( p );
+}
+int Bmc_SatShareNum( Bmc_SatShare_t * p )
+{
+    return p->nClauses;
+}
+static inline void Bmc_SatShareLock( Bmc_SatShare_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void Bmc_SatShareUnlock( Bmc_SatShare_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+// called by the solver for each learned clause
+static void Bmc_SatShareLearnt( void * pMan, int * pLits, int nLits )
+{
+    Bmc_Sat_t * p = (Bmc_Sat_t *)pMan;
+    Vec_IntPush( p->vExport, nLits );
+    Vec_IntPushArray( p->vExport, pLits, nLits );
+    if ( Vec_IntSize(p->vExport) >= BMC_SAT_EXPORT_MAX )
+        Bmc_SatShareFlush( p );
+}
+void Bmc_SatShareConnect( Bmc_Sat_t * p, Bmc_SatShare_t * pShare )
+{
+    assert( p->pShare == NULL );
+    p->pShare  = pShare;
+    p->vExport = Vec_IntAlloc( 1000 );
+    p->vImport = Vec_IntAlloc( 1000 );
+    Bmc_SatShareLock( pShare );
+    p->iShareId   = pShare->nSolvers++;
+    p->iShareNext = Vec_IntSize( &pShare->vLog );
+    Bmc_SatShareUnlock( pShare );
+    if ( p->Type == BMC_SAT_BSAT )
+        sat_solver_set_learnt_func( (sat_solver *)p->pSat, p, Bmc_SatShareLearnt, pShare->nLitsMax );
+    else if ( p->Type == BMC_SAT_SATOKO )
+        satoko_set_learnt_func( (satoko_t *)p->pSat, p, Bmc_SatShareLearnt, pShare->nLitsMax );
+    else if ( p->Type == BMC_SAT_GLUCOSE )
+        bmcg2_sat_solver_set_learnt_func( (bmcg2_sat_solver *)p->pSat, p, Bmc_SatShareLearnt, pShare->nLitsMax );
+}
+// queues a clause known to be implied (for example, a proved property)
+void Bmc_SatShareClause( Bmc_Sat_t * p, int * pLits, int nLits )
+{
+    assert( p->pShare != NULL );
+    Bmc_SatShareLearnt( p, pLits, nLits );
+}
+// publishes the queued clauses
+void Bmc_SatShareFlush( Bmc_Sat_t * p )
+{
+    Bmc_SatShare_t * pShare = p->pShare;
+    int i, nLits;
+    if ( Vec_IntSize(p->vExport) == 0 )
+        return;
+    Bmc_SatShareLock( pShare );
+    for ( i = 0; i < Vec_IntSize(p->vExport); i += nLits + 1 )
+    {
+        nLits = Vec_IntEntry( p->vExport, i );
+        if ( Vec_IntSize(&pShare->vLog) + nLits + 2 > pShare->nLogMax )
+            break;
+        Vec_IntPushTwo( &pShare->vLog, p->iShareId, nLits );
+        Vec_IntPushArray( &pShare->vLog, Vec_IntArray(p->vExport) + i+1, nLits );
+        pShare->nClauses++;
+        p->nExported++;
+    }
+    Bmc_SatShareUnlock( pShare );
+    Vec_IntClear( p->vExport );
+}
+// adds the clauses published by other solvers (at the top level only);
+// the clauses with unknown variables are kept until the variables are added
+void Bmc_SatShareImport( Bmc_Sat_t * p )
+{
+    Bmc_SatShare_t * pShare = p->pShare;
+    int i, k, j = 0, nLits, * pLits, nVars = Bmc_SatVarNum( p );
+    Bmc_SatShareLock( pShare );
+    Vec_IntPushArray( p->vImport, Vec_IntArray(&pShare->vLog) + p->iShareNext, Vec_IntSize(&pShare->vLog) - p->iShareNext );
+    p->iShareNext = Vec_IntSize( &pShare->vLog );
+    Bmc_SatShareUnlock( pShare );
+    for ( i = 0; i < Vec_IntSize(p->vImport); i += nLits + 2 )
+    {
+        nLits = Vec_IntEntry( p->vImport, i+1 );
+        pLits = Vec_IntArray( p->vImport ) + i+2;
+        if ( Vec_IntEntry(p->vImport, i) == p->iShareId )
+            continue;
+        for ( k = 0; k < nLits; k++ )
+            if ( Abc_Lit2Var(pLits[k]) >= nVars )
+                break;
+        if ( k == nLits )
+        {
+            Bmc_SatAddClause( p, pLits, nLits );
+            p->nImported++;
+            continue;
+        }
+        for ( k = 0; k < nLits + 2; k++ )
+            Vec_IntWriteEntry( p->vImport, j++, Vec_IntEntry(p->vImport, i+k) );
+    }
+    Vec_IntShrink( p->vImport, j );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -466,6 +466,59 @@ static inline int Sat_MemCompactLearned( Sat_Mem_t * p, int fDoMove )
     return Counter;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Releases the pages beyond the current ones.]
+
+  Description [Keeps one spare page of each type to avoid reallocation
+  when the clause database grows again right after compaction.
+  Returns the number of freed pages.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sat_MemTrim( Sat_Mem_t * p )
+{
+    int i, Counter = 0;
+    for ( i = 2; i < p->nPagesAlloc; i++ )
+        if ( p->pPages[i] && i > p->iPage[i & 1] + 2 )
+        {
+            ABC_FREE( p->pPages[i] );
+            Counter++;
+        }
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reports memory allocated and memory used by the pages.]
+
+  Description [The difference is the fragmentation of the arena:
+  unused tails of the pages and the spare pages.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline double Sat_MemMemoryAlloc( Sat_Mem_t * p )
+{
+    int i, Counter = 0;
+    for ( i = 0; i < p->nPagesAlloc; i++ )
+        Counter += (p->pPages[i] != NULL);
+    return 1.0 * Counter * (1 << (p->nPageSize+2));
+}
+static inline double Sat_MemMemoryLive( Sat_Mem_t * p )
+{
+    int i, Counter = 0;
+    for ( i = 0; i <= Abc_MaxInt(p->iPage[0], p->iPage[1]); i++ )
+        if ( i <= p->iPage[i & 1] )
+            Counter += Sat_MemLimit( p->pPages[i] );
+    return 4.0 * Counter;
+}
+
 
 ABC_NAMESPACE_HEADER_END
 
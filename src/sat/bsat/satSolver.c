@@ -721,6 +721,8 @@ static void sat_solver_record(sat_solver* s, veci* cls)
     assert(veci_size(cls) > 0);
     if ( h == 0 )
         veci_push( &s->unit_lits, *begin );
+    if ( s->pLearntFunc && veci_size(cls) <= s->nLearntExport )
+        s->pLearntFunc( s->pLearntMan, begin, veci_size(cls) );
 
     ///////////////////////////////////
     // add clause to internal storage
@@ -1399,6 +1401,11 @@ void sat_solver_restart( sat_solver* s )
         s->wlists[i].size = 0;
 
     s->nDBreduces = 0;
+    s->nVivifyReduces = 0;
+    s->iVivifyNext = 0;
+    s->nVivifyProps = 0;
+    s->nCompactProps = 0;
+    s->simpdb_assigns = 0;
 
     // initialize other vars
     s->size                   = 0;
@@ -1445,6 +1452,11 @@ void zsat_solver_restart_seed( sat_solver* s, double seed )
         s->wlists[i].size = 0;
 
     s->nDBreduces = 0;
+    s->nVivifyReduces = 0;
+    s->iVivifyNext = 0;
+    s->nVivifyProps = 0;
+    s->nCompactProps = 0;
+    s->simpdb_assigns = 0;
 
     // initialize other vars
     s->size                   = 0;
@@ -1507,16 +1519,79 @@ double sat_solver_memory( sat_solver* s )
     Mem += s->act_clas.cap * sizeof(int);
     Mem += s->temp_clause.cap * sizeof(int);
     Mem += s->conf_final.cap * sizeof(int);
-    Mem += Sat_MemMemoryAll( &s->Mem );
+    Mem += Sat_MemMemoryAlloc( &s->Mem );
     return Mem;
 }
 
-int sat_solver_simplify(sat_solver* s)
+// removes the marked learned clauses and updates the handles in reasons and watches
+static void sat_solver_compact_learned(sat_solver* s)
 {
-    assert(sat_solver_dl(s) == 0);
-    if (sat_solver_propagate(s) != 0)
-        return false;
-    return true;
+    Sat_Mem_t * pMem = &s->Mem;
+    int * act_clas = veci_begin(&s->act_clas);
+    int * pArray;
+    int i, k, j, Counter;
+    clause * c;
+
+    // update activities and statistics
+    j = 0;
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        if ( !c->mark )
+            act_clas[j++] = act_clas[clause_id(c)];
+        else
+        {
+            s->stats.learnts_literals -= clause_size(c);
+            s->stats.learnts--;
+        }
+    }
+    assert( s->stats.learnts == (unsigned)j );
+    veci_resize(&s->act_clas,j);
+
+    // update ID of each clause to be its new handle
+    Counter = Sat_MemCompactLearned( pMem, 0 );
+    assert( Counter == (int)s->stats.learnts );
+
+    // update reasons
+    for ( i = 0; i < s->size; i++ )
+    {
+        if ( !s->reasons[i] ) // no reason
+            continue;
+        if ( clause_is_lit(s->reasons[i]) ) // 2-lit clause
+            continue;
+        if ( !clause_learnt_h(pMem, s->reasons[i]) ) // problem clause
+            continue;
+        c = clause_read( s, s->reasons[i] );
+        assert( c->mark == 0 );
+        s->reasons[i] = clause_id(c); // updating handle here!!!
+    }
+
+    // update watches
+    for ( i = 0; i < s->size*2; i++ )
+    {
+        pArray = veci_begin(&s->wlists[i]);
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        {
+            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
+                pArray[j++] = pArray[k];
+            else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+                pArray[j++] = pArray[k];
+            else 
+            {
+                c = clause_read(s, pArray[k]);
+                if ( !c->mark ) // useful learned clause
+                   pArray[j++] = clause_id(c); // updating handle here!!!
+            }
+        }
+        veci_resize(&s->wlists[i],j);
+    }
+
+    // perform final move of the clauses
+    Counter = Sat_MemCompactLearned( pMem, 1 );
+    assert( Counter == (int)s->stats.learnts );
+
+    // release the pages that are no longer used
+    if ( s->fInprocess )
+        s->nPagesFreed += Sat_MemTrim( pMem );
 }
 
 void sat_solver_reducedb(sat_solver* s)
@@ -1526,8 +1601,8 @@ void sat_solver_reducedb(sat_solver* s)
     Sat_Mem_t * pMem = &s->Mem;
     int nLearnedOld = veci_size(&s->act_clas);
     int * act_clas = veci_begin(&s->act_clas);
-    int * pPerm, * pArray, * pSortValues, nCutoffValue;
-    int i, k, j, Id, Counter, CounterStart, nSelected;
+    int * pPerm, * pSortValues, nCutoffValue;
+    int i, k, Id, Counter, CounterStart, nSelected;
     clause * c;
 
     assert( s->nLearntMax > 0 );
@@ -1567,74 +1642,307 @@ void sat_solver_reducedb(sat_solver* s)
 //    ActCutOff = ABC_INFINITY;
 
     // mark learned clauses to remove
-    Counter = j = 0;
+    Counter = 0;
     Sat_MemForEachLearned( pMem, c, i, k )
     {
         assert( c->mark == 0 );
-        if ( Counter++ > CounterStart || clause_size(c) < 3 || pSortValues[clause_id(c)] > nCutoffValue || s->reasons[lit_var(c->lits[0])] == Sat_MemHand(pMem, i, k) )
-            act_clas[j++] = act_clas[clause_id(c)];
-        else // delete
-        {
+        if ( !(Counter++ > CounterStart || clause_size(c) < 3 || pSortValues[clause_id(c)] > nCutoffValue || s->reasons[lit_var(c->lits[0])] == Sat_MemHand(pMem, i, k)) )
             c->mark = 1;
-            s->stats.learnts_literals -= clause_size(c);
-            s->stats.learnts--;
-        }
     }
-    assert( s->stats.learnts == (unsigned)j );
     assert( Counter == nLearnedOld );
-    veci_resize(&s->act_clas,j);
     ABC_FREE( pSortValues );
 
-    // update ID of each clause to be its new handle
-    Counter = Sat_MemCompactLearned( pMem, 0 );
-    assert( Counter == (int)s->stats.learnts );
+    // remove the marked clauses
+    sat_solver_compact_learned( s );
 
-    // update reasons
-    for ( i = 0; i < s->size; i++ )
+    // report the results
+    TimeTotal += Abc_Clock() - clk;
+    if ( s->fVerbose )
     {
-        if ( !s->reasons[i] ) // no reason
-            continue;
-        if ( clause_is_lit(s->reasons[i]) ) // 2-lit clause
-            continue;
-        if ( !clause_learnt_h(pMem, s->reasons[i]) ) // problem clause
+    Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
+        s->stats.learnts, nLearnedOld, 100.0 * s->stats.learnts / nLearnedOld );
+    Abc_PrintTime( 1, "Time", TimeTotal );
+    }
+}
+
+// clears the reasons of the top-level assignments (they are never used in conflict analysis)
+static void sat_solver_clear_top_reasons(sat_solver* s)
+{
+    int i;
+    assert( sat_solver_dl(s) == 0 );
+    for ( i = 0; i < s->qtail; i++ )
+        s->reasons[lit_var(s->trail[i])] = 0;
+}
+
+// undoes the assignments above the top level without updating the saved polarity
+static void sat_solver_cancel_probing(sat_solver* s)
+{
+    int c, bound;
+    if ( sat_solver_dl(s) == 0 )
+        return;
+    bound = (veci_begin(&s->trail_lim))[0];
+    for ( c = s->qtail-1; c >= bound; c-- )
+    {
+        int x = lit_var(s->trail[c]);
+        var_set_value(s, x, varX);
+        s->reasons[x] = 0;
+    }
+    for ( c = s->qhead-1; c >= bound; c-- )
+        order_unassigned(s, lit_var(s->trail[c]));
+    s->qhead = s->qtail = bound;
+    veci_resize(&s->trail_lim, 0);
+}
+
+// removes the clauses satisfied on the top level and the false literals
+// of the remaining problem clauses, then packs the problem clauses in the arena
+static void sat_solver_compact_problem(sat_solver* s)
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    int nPageLimit = 1 << pMem->nPageSize;
+    int i, k, j, m, iNew, kNew, nInts, nIntsNew, nSizeOld, hNew, fSat;
+    int * pArray;
+    clause * c;
+    assert( sat_solver_dl(s) == 0 && s->qhead == s->qtail );
+    sat_solver_clear_top_reasons( s );
+
+    // mark the satisfied learned clauses (binary ones are kept, similar to reduceDB)
+    fSat = 0;
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        if ( clause_size(c) < 3 )
             continue;
-        c = clause_read( s, s->reasons[i] );
-        assert( c->mark == 0 );
-        s->reasons[i] = clause_id(c); // updating handle here!!!
+        for ( j = 0; j < clause_size(c); j++ )
+            if ( var_value(s, lit_var(c->lits[j])) == lit_sign(c->lits[j]) )
+                break;
+        if ( j < clause_size(c) )
+            c->mark = fSat = 1;
     }
+    if ( fSat )
+        sat_solver_compact_learned( s );
 
-    // update watches
+    // remove the watches of the problem clauses
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
         for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
-        {
-            if ( clause_is_lit(pArray[k]) ) // 2-lit clause
+            if ( clause_is_lit(pArray[k]) || clause_learnt_h(pMem, pArray[k]) )
                 pArray[j++] = pArray[k];
-            else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
-                pArray[j++] = pArray[k];
-            else 
-            {
-                c = clause_read(s, pArray[k]);
-                if ( !c->mark ) // useful learned clause
-                   pArray[j++] = clause_id(c); // updating handle here!!!
-            }
-        }
         veci_resize(&s->wlists[i],j);
     }
 
-    // perform final move of the clauses
-    Counter = Sat_MemCompactLearned( pMem, 1 );
-    assert( Counter == (int)s->stats.learnts );
+    // move the remaining problem clauses, skipping the special binary clause
+    iNew = 0;
+    kNew = 2 + Sat_MemClauseSize(s->binary);
+    for ( i = 0; i <= pMem->iPage[0]; i += 2 )
+    for ( k = i ? 2 : kNew; k < Sat_MemLimit(pMem->pPages[i]); k += nInts )
+    {
+        c = Sat_MemClause( pMem, i, k );
+        nInts = Sat_MemClauseSize(c);
+        nSizeOld = clause_size(c);
+        // drop false literals
+        for ( j = m = 0; j < nSizeOld; j++ )
+        {
+            int Value = var_value(s, lit_var(c->lits[j]));
+            if ( Value == lit_sign(c->lits[j]) )
+                break;
+            if ( Value == varX )
+                c->lits[m++] = c->lits[j];
+        }
+        if ( j < nSizeOld ) // satisfied
+        {
+            s->stats.clauses--;
+            s->stats.clauses_literals -= nSizeOld;
+            pMem->nEntries[0]--;
+            s->nCompactCla++;
+            continue;
+        }
+        // a clause without a true literal has at least two unassigned ones after propagation
+        assert( m >= 2 );
+        s->stats.clauses_literals -= nSizeOld - m;
+        s->nCompactLits += nSizeOld - m;
+        c->size = m;
+        nIntsNew = Sat_MemClauseSize(c);
+        if ( kNew + nIntsNew + 2 >= nPageLimit )
+        {
+            Sat_MemWriteLimit( pMem->pPages[iNew], kNew );
+            iNew += 2;
+            kNew = 2;
+        }
+        // the new position never exceeds the old one because clauses only shrink
+        assert( iNew < i || (iNew == i && kNew <= k) );
+        if ( iNew != i || kNew != k )
+            memmove( pMem->pPages[iNew] + kNew, c, sizeof(int) * nIntsNew );
+        hNew = Sat_MemHand( pMem, iNew, kNew );
+        c = clause_read( s, hNew );
+        // a clause that becomes two-literal stays in the arena (so that it is
+        // written by Sat_SolverWriteDimacs) but is watched by literals, like the
+        // learned two-literal clauses; the watches of the old ones were kept
+        if ( m > 2 )
+        {
+            veci_push(sat_solver_read_wlist(s,lit_neg(c->lits[0])),hNew);
+            veci_push(sat_solver_read_wlist(s,lit_neg(c->lits[1])),hNew);
+        }
+        else if ( nSizeOld > 2 )
+        {
+            veci_push(sat_solver_read_wlist(s,lit_neg(c->lits[0])),(clause_from_lit(c->lits[1])));
+            veci_push(sat_solver_read_wlist(s,lit_neg(c->lits[1])),(clause_from_lit(c->lits[0])));
+        }
+        kNew += nIntsNew;
+    }
+    Sat_MemWriteLimit( pMem->pPages[iNew], kNew );
+    pMem->iPage[0] = iNew;
+    s->nPagesFreed += Sat_MemTrim( pMem );
+    s->nCompacts++;
+}
 
-    // report the results
-    TimeTotal += Abc_Clock() - clk;
-    if ( s->fVerbose )
+// tries to shorten the learned clause by assigning its literals to false one by one;
+// returns the new literals in vLits if the clause is shortened, and -1 if the probing used the clause itself
+static int sat_solver_vivify_clause(sat_solver* s, int h, veci* vLits, veci* vCopy)
+{
+    clause * c = clause_read( s, h );
+    int i, k, iStart, hConfl = 0, nSize = clause_size(c);
+    lit * lits;
+    assert( sat_solver_dl(s) == 0 && s->qhead == s->qtail );
+    // copy the literals because propagation reorders them
+    veci_resize( vCopy, 0 );
+    for ( i = 0; i < nSize; i++ )
+        veci_push( vCopy, c->lits[i] );
+    lits = veci_begin( vCopy );
+    veci_resize( vLits, 0 );
+    // the watched literals are tried last
+    for ( i = nSize - 1; i >= 0; i-- )
     {
-    Abc_Print(1, "reduceDB: Keeping %7d out of %7d clauses (%5.2f %%)  ",
-        s->stats.learnts, nLearnedOld, 100.0 * s->stats.learnts / nLearnedOld );
-    Abc_PrintTime( 1, "Time", TimeTotal );
+        int Value = var_value(s, lit_var(lits[i]));
+        if ( Value == lit_sign(lits[i]) ) // implied by the literals tried before
+        {
+            veci_push( vLits, lits[i] );
+            break;
+        }
+        if ( Value != varX ) // implied false, hence redundant
+            continue;
+        veci_push( vLits, lits[i] );
+        if ( i == 0 )
+            break;
+        iStart = s->qtail;
+        sat_solver_decision( s, lit_neg(lits[i]) );
+        hConfl = sat_solver_propagate( s );
+        // the clause should not participate in its own strengthening
+        if ( hConfl == h )
+            break;
+        for ( k = iStart; k < s->qtail; k++ )
+            if ( s->reasons[lit_var(s->trail[k])] == h )
+                break;
+        if ( k < s->qtail )
+        {
+            hConfl = h;
+            break;
+        }
+        if ( hConfl ) // the literals tried so far are implied
+            break;
+    }
+    sat_solver_cancel_probing( s );
+    if ( i >= 0 && hConfl == h )
+        return -1;
+    return veci_size(vLits) < nSize;
+}
+
+// strengthens learned clauses after the learned clause database was reduced
+static void sat_solver_vivify(sat_solver* s)
+{
+    Sat_Mem_t * pMem = &s->Mem;
+    ABC_INT64_T nPropLimit = (s->stats.propagations - s->nVivifyProps) / 10;
+    veci vLits, vCopy, vNew;
+    int i, k, j, Id, nLbd, RetValue, nDone = 0, fStop = 0;
+    clause * c;
+    assert( sat_solver_dl(s) == 0 && s->qhead == s->qtail );
+    // spend at most one tenth of the propagations since the last vivification
+    nPropLimit = s->stats.propagations + (nPropLimit < 1000 ? 1000 : nPropLimit > 1000000 ? 1000000 : nPropLimit);
+    s->nVivifyReduces = s->nDBreduces;
+    sat_solver_clear_top_reasons( s );
+    veci_new(&vLits);
+    veci_new(&vCopy);
+    veci_new(&vNew);
+    Sat_MemForEachLearned( pMem, c, i, k )
+    {
+        Id = clause_id(c);
+        if ( fStop || Id < s->iVivifyNext || clause_size(c) < 3 )
+            continue;
+        if ( s->stats.propagations >= nPropLimit )
+        {
+            fStop = 1;
+            continue;
+        }
+        s->iVivifyNext = Id + 1;
+        // delete the clause if satisfied on the top level
+        for ( j = 0; j < clause_size(c); j++ )
+            if ( var_value(s, lit_var(c->lits[j])) == lit_sign(c->lits[j]) )
+                break;
+        if ( j < clause_size(c) )
+        {
+            c->mark = 1;
+            nDone++;
+            continue;
+        }
+        RetValue = sat_solver_vivify_clause( s, Sat_MemHand(pMem, i, k), &vLits, &vCopy );
+        c = Sat_MemClause( pMem, i, k );
+        if ( RetValue <= 0 || veci_size(&vLits) < 2 )
+            continue;
+        // save the shortened clause: the LBD, the size, and the literals
+        s->nVivified++;
+        s->nVivifyLits += clause_size(c) - veci_size(&vLits);
+        veci_push( &vNew, Abc_MinInt(c->lbd, veci_size(&vLits)) );
+        veci_push( &vNew, veci_size(&vLits) );
+        for ( j = 0; j < veci_size(&vLits); j++ )
+            veci_push( &vNew, veci_begin(&vLits)[j] );
+        c->mark = 1;
+        nDone++;
+    }
+    if ( !fStop ) // reached the end
+        s->iVivifyNext = 0;
+    if ( nDone )
+    {
+        int * pNew = veci_begin(&vNew);
+        sat_solver_compact_learned( s );
+        s->iVivifyNext = Abc_MaxInt( 0, s->iVivifyNext - nDone );
+        for ( j = 0; j < veci_size(&vNew); j += 2 + pNew[j+1] )
+        {
+            nLbd = pNew[j];
+            c = clause_read( s, sat_solver_clause_new(s, pNew + j + 2, pNew + j + 2 + pNew[j+1], 1) );
+            c->lbd = nLbd;
+        }
     }
+    veci_delete(&vLits);
+    veci_delete(&vCopy);
+    veci_delete(&vNew);
+    s->nVivifyProps = s->stats.propagations;
+}
+
+// performs inprocessing on the top level when it is likely to pay off
+static void sat_solver_inprocess(sat_solver* s)
+{
+    if ( !s->fInprocess || sat_solver_dl(s) > 0 || s->qhead != s->qtail || s->pStore || s->Mem.BookMarkH[0] )
+        return;
+    // compact the arena when new top-level facts were derived and the clauses
+    // were visited at least once by propagation since the last compaction
+    if ( s->qtail > s->simpdb_assigns && s->stats.propagations - s->nCompactProps >= s->stats.clauses_literals + s->stats.learnts_literals )
+    {
+        sat_solver_compact_problem( s );
+        s->simpdb_assigns = s->qtail;
+        s->nCompactProps  = s->stats.propagations;
+    }
+    // vivify learned clauses after each reduction of the learned clause database
+    if ( s->nDBreduces > s->nVivifyReduces )
+        sat_solver_vivify( s );
+}
+
+int sat_solver_simplify(sat_solver* s)
+{
+    assert(sat_solver_dl(s) == 0);
+    if (sat_solver_propagate(s) != 0)
+        return false;
+    if (!s->fSkipSimplify)
+        sat_solver_inprocess(s);
+    return true;
 }
 
 
@@ -1727,6 +2035,11 @@ void sat_solver_rollback( sat_solver* s )
         s->iVarPivot              =  0; // the pivot for variables
         s->iTrailPivot            =  0; // the pivot for trail
         s->hProofPivot            =  1; // the pivot for proof records
+
+        // initialize inprocessing
+        s->simpdb_assigns         =  0;
+        s->nCompactProps          =  0;
+        s->nVivifyProps           =  0;
     }
 }
 
@@ -1982,6 +2295,8 @@ int sat_solver_solve_internal(sat_solver* s)
             break;
         if ( s->pFuncStop && s->pFuncStop(s->RunId) )
             break;
+        if ( s->pStop && *s->pStop )
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -2086,6 +2401,10 @@ int sat_solver_solve(sat_solver* s, lit* begin, lit* end, ABC_INT64_T nConfLimit
 
     sat_solver_set_resource_limits( s, nConfLimit, nInsLimit, nConfLimitGlobal, nInsLimitGlobal );
 
+    // simplify the clause database before the assumptions are made
+    if ( !s->fSkipSimplify )
+        sat_solver_inprocess( s );
+
 #ifdef SAT_USE_ANALYZE_FINAL
     // Perform assumptions:
     s->root_level = 0;
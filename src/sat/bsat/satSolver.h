@@ -72,6 +72,7 @@ extern void        sat_solver_set_var_activity(sat_solver* s, int * pVars, int n
 
 extern void        Sat_SolverWriteDimacs( sat_solver * p, char * pFileName, lit* assumptionsBegin, lit* assumptionsEnd, int incrementVars );
 extern void        Sat_SolverPrintStats( FILE * pFile, sat_solver * p );
+extern void        Sat_SolverPrintArena( FILE * pFile, sat_solver * p );
 extern int *       Sat_SolverGetModel( sat_solver * p, int * pVars, int nVars );
 extern void        Sat_SolverDoubleClauses( sat_solver * p, int iVar );
 
@@ -167,6 +168,18 @@ struct sat_solver_t
     int         nLearntRatio;  // ratio percentage of learned clauses
     int         nDBreduces;    // number of DB reductions
 
+    // inprocessing
+    int         nVivifyReduces;// the number of DB reductions at the last vivification
+    int         iVivifyNext;   // the learned clause to start the next vivification
+    ABC_INT64_T nVivifyProps;  // the number of propagations at the last vivification
+    ABC_INT64_T nCompactProps; // the number of propagations at the last compaction
+    int         nCompacts;     // the number of arena compactions
+    int         nCompactCla;   // the number of satisfied clauses removed
+    int         nCompactLits;  // the number of false literals removed
+    int         nVivified;     // the number of strengthened learned clauses
+    int         nVivifyLits;   // the number of literals removed by vivification
+    int         nPagesFreed;   // the number of arena pages released
+
     ABC_INT64_T nConfLimit;    // external limit on the number of conflicts
     ABC_INT64_T nInsLimit;     // external limit on the number of implications
     abctime     nRuntimeLimit; // external limit on runtime
@@ -180,6 +193,7 @@ struct sat_solver_t
     veci        pivot_vars;    // pivot variables
 
     int         fSkipSimplify; // set to one to skip simplification of the clause database
+    int         fInprocess;    // set to one to compact the clause database and vivify learned clauses
     int         fNotUseRandom; // do not allow random decisions with a fixed probability
     int         fNoRestarts;   // disables periodic restarts
 
@@ -206,6 +220,12 @@ struct sat_solver_t
     // termination callback
     int         RunId;          // SAT id in this run
     int(*pFuncStop)(int);       // callback to terminate
+    int *       pStop;          // external flag to terminate
+
+    // learned clause export
+    void *      pLearntMan;     // external clause exchange
+    void(*pLearntFunc)(void *, int *, int); // callback for each learned clause
+    int         nLearntExport;  // the largest learned clause to export
 };
 
 static inline clause * clause_read( sat_solver * s, cla h )          
@@ -361,6 +381,20 @@ static inline void sat_solver_set_stop_func( sat_solver *s, int (*fnct)(int) )
 { 
     s->pFuncStop = fnct; 
 }
+static inline void sat_solver_set_stop( sat_solver *s, int * pStop ) 
+{ 
+    s->pStop = pStop; 
+}
+static inline void sat_solver_set_inprocess( sat_solver *s, int fInprocess ) 
+{ 
+    s->fInprocess = fInprocess; 
+}
+static inline void sat_solver_set_learnt_func( sat_solver *s, void * pMan, void (*fnct)(void *, int *, int), int nLitsMax ) 
+{ 
+    s->pLearntMan    = pMan; 
+    s->pLearntFunc   = fnct; 
+    s->nLearntExport = nLitsMax; 
+}
 
 static inline int sat_solver_add_const( sat_solver * pSat, int iVar, int fCompl )
 {
@@ -198,6 +198,30 @@ void Sat_SolverPrintStats( FILE * pFile, sat_solver * p )
     printf( "propagations  : %16.0f\n", Sat_Wrd2Dbl(p->stats.propagations) );
 //    printf( "inspects      : %10d\n", (int)p->stats.inspects );
 //    printf( "inspects2     : %10d\n", (int)p->stats.inspects2 );
+    Sat_SolverPrintArena( pFile, p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the clause arena.]
+
+  Description [Fragmentation is the part of the allocated pages that
+  does not hold clauses: the unused page tails and the spare pages.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sat_SolverPrintArena( FILE * pFile, sat_solver * p )
+{
+    double MemAlloc = Sat_MemMemoryAlloc( &p->Mem );
+    double MemLive  = Sat_MemMemoryLive( &p->Mem );
+    printf( "arena memory  : %16.2f MB (live %.2f MB, fragmentation %.2f %%)\n", 
+        MemAlloc / (1<<20), MemLive / (1<<20), MemAlloc ? 100.0 * (MemAlloc - MemLive) / MemAlloc : 0.0 );
+    printf( "compactions   : %16d (removed %d clauses and %d literals, released %d pages)\n", 
+        p->nCompacts, p->nCompactCla, p->nCompactLits, p->nPagesFreed );
+    printf( "vivified      : %16d (removed %d literals)\n", p->nVivified, p->nVivifyLits );
 }
 
 /**Function*************************************************************
@@ -27,7 +27,12 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// each thread derives CNF with its own manager
+#ifdef _MSC_VER
 static Cnf_Man_t * s_pManCnf = NULL;
+#else
+static __thread Cnf_Man_t * s_pManCnf = NULL;
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -252,6 +252,13 @@ void bmcg2_sat_solver_set_conflict_budget(bmcg2_sat_solver* s, int Limit)
         ((Gluco2::SimpSolver*)s)->budgetOff();
 }
 
+void bmcg2_sat_solver_set_learnt_func(bmcg2_sat_solver* s, void * pMan, void (*pFunc)(void *, int *, int), int nLitsMax)
+{
+    ((Gluco2::SimpSolver*)s)->pLearntMan    = pMan;
+    ((Gluco2::SimpSolver*)s)->pLearntFunc   = pFunc;
+    ((Gluco2::SimpSolver*)s)->nLearntExport = nLitsMax;
+}
+
 int bmcg2_sat_solver_varnum(bmcg2_sat_solver* s)
 {
     return ((Gluco2::SimpSolver*)s)->nVars();
@@ -604,6 +611,13 @@ void bmcg2_sat_solver_set_conflict_budget(bmcg2_sat_solver* s, int Limit)
         ((Gluco2::Solver*)s)->budgetOff();
 }
 
+void bmcg2_sat_solver_set_learnt_func(bmcg2_sat_solver* s, void * pMan, void (*pFunc)(void *, int *, int), int nLitsMax)
+{
+    ((Gluco2::Solver*)s)->pLearntMan    = pMan;
+    ((Gluco2::Solver*)s)->pLearntFunc   = pFunc;
+    ((Gluco2::Solver*)s)->nLearntExport = nLitsMax;
+}
+
 int bmcg2_sat_solver_varnum(bmcg2_sat_solver* s)
 {
     return ((Gluco2::Solver*)s)->nVars();
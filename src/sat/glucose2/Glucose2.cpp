@@ -98,6 +98,9 @@ Solver::Solver() :
     , terminate_search_early(false)
     , pstop(NULL)
     , nRuntimeLimit(0)
+    , pLearntMan(NULL)
+    , pLearntFunc(NULL)
+    , nLearntExport(0)
 
     , verbosity      (0)
     , verbEveryConflicts(10000)
@@ -1256,6 +1259,9 @@ lbool Solver::search(int nof_conflicts)
               fprintf(certifiedOutput, "0\n");
             }
 
+            if (pLearntFunc && learnt_clause.size() <= nLearntExport)
+                pLearntFunc(pLearntMan, (int *)(Lit *)learnt_clause, learnt_clause.size());
+
             if (learnt_clause.size() == 1){
               uncheckedEnqueue(learnt_clause[0]);nbUn++;
             }else{
@@ -63,6 +63,9 @@ public:
     bool terminate_search_early;         // used to stop the solver early if it as instructed by an external caller
     int * pstop;                         // another callback
     uint64_t nRuntimeLimit;              // runtime limit
+    void * pLearntMan;                   // external clause exchange
+    void(*pLearntFunc)(void * p, int*, int); // callback for each learned clause
+    int nLearntExport;                   // the largest learned clause to export
     vec<int> user_vec;
     vec<Lit> user_lits;
 
@@ -139,6 +139,7 @@ extern int satoko_conflictnum(satoko_t *);
 extern void satoko_set_stop(satoko_t *, int *);
 extern void satoko_set_stop_func(satoko_t *s, int (*fnct)(int));
 extern void satoko_set_runid(satoko_t *, int);
+extern void satoko_set_learnt_func(satoko_t *, void *, void (*)(void *, int *, int), int);
 extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
 extern char satoko_var_polarity(satoko_t *, unsigned);
@@ -355,6 +355,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
         cref = solver_clause_create(s, s->temp_lits, 1);
         clause_watch(s, cref);
     }
+    if (s->pLearntFunc && (int)vec_uint_size(s->temp_lits) <= s->nLearntExport)
+        s->pLearntFunc(s->pLearntMan, (int *)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
     solver_enqueue(s, vec_uint_at(s->temp_lits, 0), cref);
     var_act_decay(s);
     clause_act_decay(s);
@@ -106,6 +106,11 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Callback to export learned clauses */
+    void   *pLearntMan;
+    void  (*pLearntFunc)(void *, int *, int);
+    int     nLearntExport;
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -657,6 +657,13 @@ void satoko_set_runid(satoko_t *s, int id)
     s->RunId = id;
 }
 
+void satoko_set_learnt_func(satoko_t *s, void *pman, void (*fnct)(void *, int *, int), int nlitsmax)
+{
+    s->pLearntMan = pman;
+    s->pLearntFunc = fnct;
+    s->nLearntExport = nlitsmax;
+}
+
 int satoko_read_cex_varvalue(satoko_t *s, int ivar)
 {
     return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;
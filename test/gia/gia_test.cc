@@ -1,9 +1,24 @@
 #include "gtest/gtest.h"
 
 #include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "proof/cec/cec.h"
+#include "map/if/if.h"
 
 ABC_NAMESPACE_IMPL_START
 
+// reads the contents of a file
+static Vec_Str_t* ReadContents(const char* pFileName) {
+  Vec_Str_t* vContents = Vec_StrAlloc(1000);
+  FILE* file = fopen(pFileName, "rb");
+  if (file == nullptr)
+    return vContents;
+  for (int c = fgetc(file); c != EOF; c = fgetc(file))
+    Vec_StrPush(vContents, (char)c);
+  fclose(file);
+  return vContents;
+}
+
 TEST(GiaTest, CanAllocateGiaManager) {
   Gia_Man_t* aig_manager =  Gia_ManStart(100);
 
@@ -51,4 +66,162 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, HashAndFindsNodesWhileResizing) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+  Vec_Int_t* fanins = Vec_IntAlloc(40000);
+  Vec_Int_t* outputs = Vec_IntAlloc(20000);
+  unsigned seed = 1;
+
+  for (int i = 0; i < 100; i++)
+    Gia_ManAppendCi(aig_manager);
+  Gia_ManHashAlloc(aig_manager);
+  // the table starts small and is resized several times
+  for (int i = 0; i < 20000; i++) {
+    seed = seed * 1103515245 + 12345;
+    int lit0 = 2 + (seed >> 8) % (2 * Gia_ManObjNum(aig_manager) - 2);
+    seed = seed * 1103515245 + 12345;
+    int lit1 = 2 + (seed >> 8) % (2 * Gia_ManObjNum(aig_manager) - 2);
+    Vec_IntPushTwo(fanins, lit0, lit1);
+    Vec_IntPush(outputs, Gia_ManHashAnd(aig_manager, lit0, lit1));
+  }
+  int num_ands = Gia_ManAndNum(aig_manager);
+
+  // hashing the same gates again, with the fanins swapped, adds no nodes
+  for (int i = 0; i < Vec_IntSize(outputs); i++) {
+    int lit0 = Vec_IntEntry(fanins, 2 * i);
+    int lit1 = Vec_IntEntry(fanins, 2 * i + 1);
+    EXPECT_EQ(Gia_ManHashAnd(aig_manager, lit1, lit0), Vec_IntEntry(outputs, i));
+  }
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), num_ands);
+
+  Vec_IntFree(fanins);
+  Vec_IntFree(outputs);
+  Gia_ManHashStop(aig_manager);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, SnapshotReaderRejectsTruncatedData) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, input1, input2));
+  aig_manager->pName = Abc_UtilStrsav((char*)"snap");
+
+  FILE* file = tmpfile();
+  ASSERT_TRUE(file != nullptr);
+  Gia_ManSnapWrite(aig_manager, file);
+  long size = ftell(file);
+  rewind(file);
+  unsigned char* buffer = ABC_ALLOC(unsigned char, size);
+  ASSERT_EQ(fread(buffer, 1, size, file), (size_t)size);
+  fclose(file);
+
+  unsigned char* position = buffer;
+  Gia_Man_t* loaded = Gia_ManSnapRead(&position, buffer + size);
+  ASSERT_TRUE(loaded != nullptr);
+  EXPECT_EQ(position, buffer + size);
+  EXPECT_EQ(Gia_ManAndNum(loaded), 1);
+  EXPECT_EQ(Gia_ManCoNum(loaded), 1);
+  Gia_ManStop(loaded);
+
+  // every proper prefix of the snapshot is rejected
+  for (long length = 0; length < size; length++) {
+    position = buffer;
+    EXPECT_TRUE(Gia_ManSnapRead(&position, buffer + length) == nullptr);
+    EXPECT_EQ(position, buffer);
+  }
+  ABC_FREE(buffer);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, OrchestrateIsEquivalent) {
+  // rewriting uses the decomposition manager of the global frame
+  Abc_Start();
+  Gia_Man_t* aig_manager = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(aig_manager != nullptr);
+
+  // the default parameters of &orchestrate
+  Gia_Man_t* result = Gia_ManOrchestrate(aig_manager, 8, 1, 10, 1, 1, 0, 0);
+  ASSERT_TRUE(result != nullptr);
+  EXPECT_EQ(Gia_ManCiNum(result), Gia_ManCiNum(aig_manager));
+  EXPECT_EQ(Gia_ManCoNum(result), Gia_ManCoNum(aig_manager));
+  EXPECT_LT(Gia_ManAndNum(result), Gia_ManAndNum(aig_manager));
+  EXPECT_EQ(Cec_ManVerifyTwo(aig_manager, result, 0), 1);
+
+  // the result does not depend on the state left by the previous call
+  Gia_Man_t* again = Gia_ManOrchestrate(aig_manager, 8, 1, 10, 1, 1, 0, 0);
+  EXPECT_EQ(Gia_ManAndNum(again), Gia_ManAndNum(result));
+  Gia_ManStop(again);
+  Gia_ManStop(result);
+  Gia_ManStop(aig_manager);
+  Abc_Stop();
+}
+
+TEST(GiaTest, LutMappingDoesNotDependOnThreads) {
+  Gia_Man_t* aig_manager = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(aig_manager != nullptr);
+  Gia_Man_t* mapped[2];
+  int num_procs[2] = {0, 4};
+
+  // map into 6-input LUTs sequentially and with four threads
+  for (int i = 0; i < 2; i++) {
+    If_Par_t pars;
+    Gia_ManSetIfParsDefault(&pars);
+    pars.nLutSize = 6;
+    pars.nProcs = num_procs[i];
+    mapped[i] = Gia_ManPerformMapping(aig_manager, &pars);
+    ASSERT_TRUE(mapped[i] != nullptr);
+    ASSERT_TRUE(Gia_ManHasMapping(mapped[i]));
+  }
+  EXPECT_EQ(Gia_ManAndNum(mapped[0]), Gia_ManAndNum(mapped[1]));
+  EXPECT_EQ(Gia_ManLutNum(mapped[0]), Gia_ManLutNum(mapped[1]));
+  EXPECT_EQ(Gia_ManLutLevel(mapped[0], NULL), Gia_ManLutLevel(mapped[1], NULL));
+  EXPECT_TRUE(Vec_IntEqual(mapped[0]->vMapping, mapped[1]->vMapping));
+  Gia_ManStop(mapped[0]);
+  Gia_ManStop(mapped[1]);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, AigerDoesNotDependOnThreads) {
+  Gia_Man_t* aig_manager = Gia_AigerRead((char*)"../../i10.aig", 0, 0, 0);
+  ASSERT_TRUE(aig_manager != nullptr);
+  const char* file_names[2] = {"aiger_seq.aig", "aiger_par.aig"};
+  Vec_Str_t* contents[2];
+  Gia_Man_t* loaded[2];
+  int num_procs[2] = {1, 4};
+
+  // the concurrent writer produces the same file
+  for (int i = 0; i < 2; i++) {
+    Gia_AigerWriteSPar(aig_manager, (char*)file_names[i], 0, 0, 0, 0, num_procs[i]);
+    contents[i] = ReadContents(file_names[i]);
+  }
+  EXPECT_GT(Vec_StrSize(contents[0]), 0);
+  EXPECT_EQ(Vec_StrSize(contents[0]), Vec_StrSize(contents[1]));
+  EXPECT_EQ(memcmp(Vec_StrArray(contents[0]), Vec_StrArray(contents[1]), Vec_StrSize(contents[0])), 0);
+
+  // the concurrent reader produces the same AIG
+  for (int i = 0; i < 2; i++) {
+    loaded[i] = Gia_AigerReadPar((char*)file_names[0], 0, 1, 0, num_procs[i]);
+    ASSERT_TRUE(loaded[i] != nullptr);
+  }
+  ASSERT_EQ(Gia_ManObjNum(loaded[0]), Gia_ManObjNum(loaded[1]));
+  EXPECT_EQ(Gia_ManAndNum(loaded[0]), Gia_ManAndNum(aig_manager));
+  EXPECT_EQ(Gia_ManAndNum(loaded[1]), Gia_ManAndNum(aig_manager));
+  Gia_Obj_t* pObj;
+  int k;
+  Gia_ManForEachAnd(loaded[0], pObj, k) {
+    Gia_Obj_t* pObj2 = Gia_ManObj(loaded[1], k);
+    EXPECT_EQ(Gia_ObjFaninLit0(pObj, k), Gia_ObjFaninLit0(pObj2, k));
+    EXPECT_EQ(Gia_ObjFaninLit1(pObj, k), Gia_ObjFaninLit1(pObj2, k));
+  }
+  EXPECT_EQ(Cec_ManVerifyTwo(aig_manager, loaded[1], 0), 1);
+
+  for (int i = 0; i < 2; i++) {
+    Gia_ManStop(loaded[i]);
+    Vec_StrFree(contents[i]);
+    remove(file_names[i]);
+  }
+  Gia_ManStop(aig_manager);
+}
+
 ABC_NAMESPACE_IMPL_END
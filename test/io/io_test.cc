@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+
+#include "base/abc/abc.h"
+#include "base/io/ioAbc.h"
+#include "base/main/main.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// writes a BLIF file with nInputs inputs and nNodes random tables,
+// which use the on-set or the off-set, don't-cares, and constants
+static void WriteRandomBlif(const char* pFileName, int nInputs, int nNodes) {
+  FILE* file = fopen(pFileName, "w");
+  unsigned seed = 1;
+  fprintf(file, ".model random\n.inputs");
+  for (int i = 0; i < nInputs; i++)
+    fprintf(file, " i%d", i);
+  fprintf(file, "\n.outputs");
+  for (int i = nNodes - 10; i < nNodes; i++)
+    fprintf(file, " n%d", i);
+  fprintf(file, "\n");
+  for (int i = 0; i < nNodes; i++) {
+    seed = seed * 1103515245 + 12345;
+    int nFanins = (seed >> 8) % 5;
+    fprintf(file, ".names");
+    for (int k = 0; k < nFanins; k++) {
+      seed = seed * 1103515245 + 12345;
+      int iFanin = (seed >> 8) % (nInputs + i);
+      if (iFanin < nInputs)
+        fprintf(file, " i%d", iFanin);
+      else
+        fprintf(file, " n%d", iFanin - nInputs);
+    }
+    fprintf(file, " n%d\n", i);
+    seed = seed * 1103515245 + 12345;
+    char Phase = "01"[(seed >> 8) & 1];
+    int nCubes = nFanins ? 1 + (seed >> 12) % 4 : 1;
+    for (int c = 0; c < nCubes; c++) {
+      for (int k = 0; k < nFanins; k++) {
+        seed = seed * 1103515245 + 12345;
+        fputc("01-"[(seed >> 8) % 3], file);
+      }
+      fprintf(file, nFanins ? " %c\n" : "%c\n", Phase);
+    }
+  }
+  fprintf(file, ".end\n");
+  fclose(file);
+}
+
+TEST(IoTest, BlifTablesDoNotDependOnThreads) {
+  const char* file_name = "io_tables.blif";
+  Abc_Ntk_t* network[2];
+  int num_procs[2] = {1, 4};
+
+  // the reader uses the library of the global frame
+  Abc_Start();
+  // enough tables to parse them concurrently
+  WriteRandomBlif(file_name, 20, 3000);
+  for (int i = 0; i < 2; i++) {
+    network[i] = Io_ReadBlifMvPar((char*)file_name, 0, 1, num_procs[i]);
+    ASSERT_TRUE(network[i] != nullptr);
+  }
+  remove(file_name);
+
+  // the networks have the same nodes with the same covers
+  ASSERT_EQ(Abc_NtkObjNumMax(network[0]), Abc_NtkObjNumMax(network[1]));
+  EXPECT_EQ(Abc_NtkNodeNum(network[0]), Abc_NtkNodeNum(network[1]));
+  EXPECT_GE(Abc_NtkNodeNum(network[0]), 3000);
+  Abc_Obj_t* pObj;
+  int i, k;
+  Abc_NtkForEachNode(network[0], pObj, i) {
+    Abc_Obj_t* pObj2 = Abc_NtkObj(network[1], i);
+    ASSERT_TRUE(pObj2 != nullptr && Abc_ObjIsNode(pObj2));
+    EXPECT_STREQ((char*)pObj->pData, (char*)pObj2->pData);
+    ASSERT_EQ(Abc_ObjFaninNum(pObj), Abc_ObjFaninNum(pObj2));
+    for (k = 0; k < Abc_ObjFaninNum(pObj); k++)
+      EXPECT_EQ(Abc_ObjFaninId(pObj, k), Abc_ObjFaninId(pObj2, k));
+  }
+  Abc_NtkDelete(network[0]);
+  Abc_NtkDelete(network[1]);
+  Abc_Stop();
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,44 @@
+#include "gtest/gtest.h"
+
+#include "base/abc/abc.h"
+#include "ext-lsv/lsv_dc.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(LsvTest, OdcWindowStopsAtLatchInputs) {
+  // m = a & b drives a latch and o = m & q, where q is the latch output
+  Abc_Ntk_t* network = Abc_NtkAlloc(ABC_NTK_STRASH, ABC_FUNC_AIG, 1);
+  Abc_Aig_t* aig = (Abc_Aig_t*)network->pManFunc;
+  Abc_Obj_t* input_a = Abc_NtkCreatePi(network);
+  Abc_Obj_t* input_b = Abc_NtkCreatePi(network);
+  Abc_Obj_t* latch = Abc_NtkCreateLatch(network);
+  Abc_Obj_t* latch_in = Abc_NtkCreateBi(network);
+  Abc_Obj_t* latch_out = Abc_NtkCreateBo(network);
+  Abc_ObjAddFanin(latch, latch_in);
+  Abc_ObjAddFanin(latch_out, latch);
+  Abc_LatchSetInit0(latch);
+  Abc_Obj_t* node_m = Abc_AigAnd(aig, input_a, input_b);
+  Abc_Obj_t* node_o = Abc_AigAnd(aig, node_m, latch_out);
+  Abc_ObjAddFanin(latch_in, node_m);
+  Abc_ObjAddFanin(Abc_NtkCreatePo(network), node_o);
+  Abc_NtkAddDummyPiNames(network);
+  Abc_NtkAddDummyPoNames(network);
+  Abc_NtkAddDummyBoxNames(network);
+
+  Lsv_DcPars_t pars;
+  Lsv_DcSetDefaultPars(&pars);
+  Vec_Ptr_t* nodes = Vec_PtrAlloc(2);
+  Vec_PtrPush(nodes, node_m);
+  Vec_PtrPush(nodes, node_o);
+  Vec_Int_t* odcs = Lsv_NtkComputeOdc(network, nodes, &pars);
+
+  // m is observable at the latch input for every pattern of a and b
+  EXPECT_EQ(Vec_IntEntry(odcs, 0), 0);
+  // the PO is the only fanout of o
+  EXPECT_EQ(Vec_IntEntry(odcs, 1), 0);
+  Vec_IntFree(odcs);
+  Vec_PtrFree(nodes);
+  Abc_NtkDelete(network);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "proof/abs/abs.h"
+#include "proof/cec/cec.h"
+#include "proof/ssw/ssw.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// appends a counter of nBits registers incrementing when iEnable is 1
+// and returns the literal that is 1 when all its registers are 1
+static int CounterAppend(Gia_Man_t* p, int iEnable, int* pRegs, int* pNexts, int nBits) {
+  int iCarry = iEnable, iAll = 1;
+  for (int i = 0; i < nBits; i++) {
+    pNexts[i] = Gia_ManHashXor(p, pRegs[i], iCarry);
+    iCarry = Gia_ManHashAnd(p, pRegs[i], iCarry);
+    iAll = Gia_ManHashAnd(p, iAll, pRegs[i]);
+  }
+  return iAll;
+}
+
+// creates a sequential miter with one input and one or two counters;
+// the first counter counts the cycles with the input equal to 1 and
+// the second one counts the cycles with the input equal to 0; the output
+// is 1 when all the registers are 1
+static Gia_Man_t* CounterMiter(int nBits, int fTwo) {
+  Gia_Man_t* p = Gia_ManStart(1000);
+  int nRegs = nBits * (fTwo ? 2 : 1);
+  int pRegs[64], pNexts[64];
+  p->pName = Abc_UtilStrsav((char*)"counter");
+  Gia_ManHashStart(p);
+  int iEnable = Gia_ManAppendCi(p);
+  for (int i = 0; i < nRegs; i++)
+    pRegs[i] = Gia_ManAppendCi(p);
+  int iOut = CounterAppend(p, iEnable, pRegs, pNexts, nBits);
+  if (fTwo) {
+    int iOut2 = CounterAppend(p, Abc_LitNot(iEnable), pRegs + nBits, pNexts + nBits, nBits);
+    iOut = Gia_ManHashAnd(p, iOut, iOut2);
+  }
+  Gia_ManAppendCo(p, iOut);
+  for (int i = 0; i < nRegs; i++)
+    Gia_ManAppendCo(p, pNexts[i]);
+  Gia_ManHashStop(p);
+  Gia_ManSetRegNum(p, nRegs);
+  return p;
+}
+
+// runs GLA with the given number of speculative solvers
+static int RunGla(Gia_Man_t* p, int nFramesMax, int nProcs, int* piFrame) {
+  Abs_Par_t pars;
+  Abs_ParSetDefaults(&pars);
+  pars.nFramesMax = nFramesMax;
+  pars.nProcs = nProcs;
+  Vec_IntFreeP(&p->vGateClasses);
+  Abc_CexFreeP(&p->pCexSeq);
+  int RetValue = Gia_ManPerformGla(p, &pars);
+  *piFrame = pars.iFrame;
+  return RetValue;
+}
+
+// runs rarity simulation with the given number of threads
+static int RunRarity(Gia_Man_t* p, int nProcs, Abc_Cex_t** ppCex) {
+  Ssw_RarPars_t pars;
+  Ssw_RarSetDefaultParams(&pars);
+  pars.nRounds = 20;
+  pars.fSilent = 1;
+  pars.nProcs = nProcs;
+  Aig_Man_t* pAig = Gia_ManToAigSimple(p);
+  int RetValue = nProcs > 1 ? Ssw_RarSimulatePar(pAig, &pars) : Ssw_RarSimulate(pAig, &pars);
+  *ppCex = pAig->pSeqModel;
+  pAig->pSeqModel = NULL;
+  Aig_ManStop(pAig);
+  return RetValue;
+}
+
+TEST(ProofTest, GlaSpeculationFindsTheSameCex) {
+  Gia_Man_t* aig_manager = CounterMiter(4, 0);
+  int iFrame[2], num_procs[2] = {0, 2};
+
+  // the output is asserted in frame 15
+  for (int i = 0; i < 2; i++) {
+    EXPECT_EQ(RunGla(aig_manager, 40, num_procs[i], iFrame + i), 0);
+    ASSERT_TRUE(aig_manager->pCexSeq != nullptr);
+    EXPECT_EQ(aig_manager->pCexSeq->iFrame, 15);
+    EXPECT_TRUE(Gia_ManVerifyCex(aig_manager, aig_manager->pCexSeq, 0));
+  }
+  EXPECT_EQ(iFrame[0], iFrame[1]);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(ProofTest, GlaSpeculationCoversTheSameFrames) {
+  // the output is not asserted before frame 62
+  Gia_Man_t* aig_manager = CounterMiter(5, 1);
+  Vec_Int_t* vGateClasses[2];
+  int iFrame[2], num_procs[2] = {0, 2};
+
+  for (int i = 0; i < 2; i++) {
+    EXPECT_EQ(RunGla(aig_manager, 30, num_procs[i], iFrame + i), -1);
+    EXPECT_TRUE(aig_manager->pCexSeq == nullptr);
+    ASSERT_TRUE(aig_manager->vGateClasses != nullptr);
+    vGateClasses[i] = Vec_IntDup(aig_manager->vGateClasses);
+  }
+  EXPECT_EQ(iFrame[0], iFrame[1]);
+  // the frames proved speculatively do not change the abstraction
+  EXPECT_TRUE(Vec_IntEqual(vGateClasses[0], vGateClasses[1]));
+  Vec_IntFree(vGateClasses[0]);
+  Vec_IntFree(vGateClasses[1]);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(ProofTest, ScorrDoesNotDependOnThreads) {
+  // the dual-output miter of two copies of the same design
+  Gia_Man_t* design = CounterMiter(8, 1);
+  Gia_Man_t* aig_manager = Gia_ManMiter(design, design, 0, 1, 1, 0, 0);
+  Gia_Man_t* result[2];
+  Vec_Int_t* reprs[2];
+  int num_threads[2] = {1, 4};
+
+  for (int i = 0; i < 2; i++) {
+    Cec_ParCor_t pars;
+    Cec_ManCorSetDefaultParams(&pars);
+    pars.nThreads = num_threads[i];
+    result[i] = Cec_ManLSCorrespondence(aig_manager, &pars);
+    ASSERT_TRUE(result[i] != nullptr);
+    reprs[i] = Vec_IntAlloc(Gia_ManObjNum(aig_manager));
+    for (int k = 0; k < Gia_ManObjNum(aig_manager); k++)
+      Vec_IntPush(reprs[i], Gia_ObjRepr(aig_manager, k));
+  }
+  EXPECT_LT(Gia_ManRegNum(result[0]), Gia_ManRegNum(aig_manager));
+  EXPECT_TRUE(Vec_IntEqual(reprs[0], reprs[1]));
+  EXPECT_EQ(Gia_ManRegNum(result[0]), Gia_ManRegNum(result[1]));
+  EXPECT_EQ(Gia_ManAndNum(result[0]), Gia_ManAndNum(result[1]));
+  for (int i = 0; i < 2; i++) {
+    Vec_IntFree(reprs[i]);
+    Gia_ManStop(result[i]);
+  }
+  Gia_ManStop(aig_manager);
+  Gia_ManStop(design);
+}
+
+TEST(ProofTest, RarityThreadsAssertTheSameOutput) {
+  // the output can be asserted in frame 15 or later
+  Gia_Man_t* aig_manager = CounterMiter(4, 0);
+  int num_procs[2] = {1, 4};
+
+  for (int i = 0; i < 2; i++) {
+    Abc_Cex_t* pCex = nullptr;
+    EXPECT_EQ(RunRarity(aig_manager, num_procs[i], &pCex), 0);
+    ASSERT_TRUE(pCex != nullptr);
+    EXPECT_EQ(pCex->iPo, 0);
+    EXPECT_GE(pCex->iFrame, 15);
+    EXPECT_TRUE(Gia_ManVerifyCex(aig_manager, pCex, 0));
+    Abc_CexFree(pCex);
+  }
+  Gia_ManStop(aig_manager);
+}
+
+TEST(ProofTest, RarityThreadsDoNotAssertSafeOutputs) {
+  // the miter of two copies of the same design is never asserted
+  Gia_Man_t* design = CounterMiter(4, 1);
+  Gia_Man_t* aig_manager = Gia_ManMiter(design, design, 0, 0, 1, 0, 0);
+  int num_procs[2] = {1, 4};
+
+  for (int i = 0; i < 2; i++) {
+    Abc_Cex_t* pCex = nullptr;
+    EXPECT_EQ(RunRarity(aig_manager, num_procs[i], &pCex), -1);
+    EXPECT_TRUE(pCex == nullptr);
+  }
+  Gia_ManStop(aig_manager);
+  Gia_ManStop(design);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+
+#include "misc/util/abc_global.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// the word counts of the tables with 0 to 16 variables, followed by
+// the word counts that are not multiples of the vector size
+static int TruthWordCounts(int* counts) {
+  int num = 0;
+  for (int nVars = 0; nVars <= 16; nVars++)
+    counts[num++] = Abc_TtWordNum(nVars);
+  for (int nWords = 3; nWords < 40; nWords += 2)
+    counts[num++] = nWords;
+  return num;
+}
+
+static void TruthRandom(word* pTruth, int nWords, unsigned* seed) {
+  for (int w = 0; w < nWords; w++) {
+    word value = 0;
+    for (int k = 0; k < 4; k++) {
+      *seed = *seed * 1103515245 + 12345;
+      value = (value << 16) | ((*seed >> 8) & 0xFFFF);
+    }
+    pTruth[w] = value;
+  }
+}
+
+// each kernel is compared with the scalar Abc_Tt* operation applied
+// to one word at a time, which never goes through the kernels
+TEST(UtilTest, TruthSimdKernelsMatchScalarCode) {
+  int counts[64];
+  int num = TruthWordCounts(counts);
+  unsigned seed = 1;
+  word pIn1[1024], pIn2[1024], pOut[1024], pRef[1024];
+
+  Abc_TtSimdStart();
+  for (int c = 0; c < num; c++) {
+    int nWords = counts[c];
+    SCOPED_TRACE(testing::Message() << Abc_TtSimdName() << " kernels, " << nWords << " words");
+    TruthRandom(pIn1, nWords, &seed);
+    TruthRandom(pIn2, nWords, &seed);
+
+    for (int fCompl = 0; fCompl < 2; fCompl++) {
+      Abc_TtSimdAnd(pOut, pIn1, pIn2, nWords, fCompl);
+      for (int w = 0; w < nWords; w++)
+        Abc_TtAnd(pRef + w, pIn1 + w, pIn2 + w, 1, fCompl);
+      EXPECT_EQ(memcmp(pOut, pRef, sizeof(word) * nWords), 0);
+
+      Abc_TtSimdXor(pOut, pIn1, pIn2, nWords, fCompl);
+      for (int w = 0; w < nWords; w++)
+        Abc_TtXor(pRef + w, pIn1 + w, pIn2 + w, 1, fCompl);
+      EXPECT_EQ(memcmp(pOut, pRef, sizeof(word) * nWords), 0);
+
+      for (int fCompl2 = 0; fCompl2 < 2; fCompl2++) {
+        Abc_TtSimdAndCompl(pOut, pIn1, fCompl, pIn2, fCompl2, nWords);
+        for (int w = 0; w < nWords; w++)
+          Abc_TtAndCompl(pRef + w, pIn1 + w, fCompl, pIn2 + w, fCompl2, 1);
+        EXPECT_EQ(memcmp(pOut, pRef, sizeof(word) * nWords), 0);
+      }
+    }
+
+    Abc_TtSimdOr(pOut, pIn1, pIn2, nWords);
+    for (int w = 0; w < nWords; w++)
+      Abc_TtOr(pRef + w, pIn1 + w, pIn2 + w, 1);
+    EXPECT_EQ(memcmp(pOut, pRef, sizeof(word) * nWords), 0);
+
+    Abc_TtSimdSharp(pOut, pIn1, pIn2, nWords);
+    for (int w = 0; w < nWords; w++)
+      Abc_TtSharp(pRef + w, pIn1 + w, pIn2 + w, 1);
+    EXPECT_EQ(memcmp(pOut, pRef, sizeof(word) * nWords), 0);
+
+    int count = 0;
+    for (int w = 0; w < nWords; w++)
+      count += Abc_TtCountOnesVec(pIn1 + w, 1);
+    EXPECT_EQ(Abc_TtSimdCountOnes(pIn1, nWords), count);
+
+    // the tables differ in one word, which is tried at every position
+    memcpy(pOut, pIn1, sizeof(word) * nWords);
+    EXPECT_TRUE(Abc_TtSimdEqual(pIn1, pOut, nWords));
+    memset(pRef, 0, sizeof(word) * nWords);
+    EXPECT_TRUE(Abc_TtSimdIsConst0(pRef, nWords));
+    for (int w = 0; w < nWords; w++) {
+      pOut[w] ^= (word)1 << (w % 64);
+      EXPECT_FALSE(Abc_TtSimdEqual(pIn1, pOut, nWords));
+      pOut[w] = pIn1[w];
+      pRef[w] = (word)1 << (63 - w % 64);
+      EXPECT_FALSE(Abc_TtSimdIsConst0(pRef, nWords));
+      EXPECT_EQ(Abc_TtSimdIsConst0(pRef, nWords), Abc_TtIsConst0(pRef + w, 1));
+      pRef[w] = 0;
+    }
+
+    memcpy(pOut, pIn1, sizeof(word) * nWords);
+    memcpy(pRef, pIn2, sizeof(word) * nWords);
+    Abc_TtSimdSwap(pOut, pRef, nWords);
+    EXPECT_EQ(memcmp(pOut, pIn2, sizeof(word) * nWords), 0);
+    EXPECT_EQ(memcmp(pRef, pIn1, sizeof(word) * nWords), 0);
+  }
+}
+
+// the operations of utilTruth.h give the same results for all table
+// sizes, whether or not they are large enough to use the kernels
+TEST(UtilTest, TruthOperationsMatchAcrossVariableCounts) {
+  unsigned seed = 2;
+  word pIn1[1024], pIn2[1024], pOut[1024], pRef[1024];
+
+  Abc_TtSimdStart();
+  for (int nVars = 7; nVars <= 16; nVars++) {
+    int nWords = Abc_TtWordNum(nVars);
+    SCOPED_TRACE(testing::Message() << nVars << " variables");
+    TruthRandom(pIn1, nWords, &seed);
+    TruthRandom(pIn2, nWords, &seed);
+
+    // cofactoring copies halves of the table
+    for (int iVar = 0; iVar < nVars; iVar++) {
+      memcpy(pOut, pIn1, sizeof(word) * nWords);
+      Abc_TtCofactor0(pOut, nWords, iVar);
+      for (int m = 0; m < 64 * nWords; m++)
+        EXPECT_EQ(Abc_TtGetBit(pOut, m), Abc_TtGetBit(pIn1, m & ~(1 << iVar)));
+      memcpy(pOut, pIn1, sizeof(word) * nWords);
+      Abc_TtCofactor1(pOut, nWords, iVar);
+      for (int m = 0; m < 64 * nWords; m++)
+        EXPECT_EQ(Abc_TtGetBit(pOut, m), Abc_TtGetBit(pIn1, m | (1 << iVar)));
+    }
+
+    // swapping two variables twice restores the table, and swapping
+    // them once permutes the minterms
+    for (int iVar = 0; iVar < nVars; iVar++)
+      for (int jVar = iVar + 1; jVar < nVars; jVar++) {
+        memcpy(pOut, pIn1, sizeof(word) * nWords);
+        Abc_TtSwapVars(pOut, nVars, iVar, jVar);
+        for (int m = 0; m < 64 * nWords; m += 7) {
+          int bitI = (m >> iVar) & 1, bitJ = (m >> jVar) & 1;
+          int n = (m & ~(1 << iVar) & ~(1 << jVar)) | (bitJ << iVar) | (bitI << jVar);
+          EXPECT_EQ(Abc_TtGetBit(pOut, m), Abc_TtGetBit(pIn1, n));
+        }
+        Abc_TtSwapVars(pOut, nVars, iVar, jVar);
+        EXPECT_TRUE(Abc_TtEqual(pOut, pIn1, nWords));
+      }
+
+    Abc_TtAnd(pOut, pIn1, pIn2, nWords, 1);
+    for (int w = 0; w < nWords; w++)
+      pRef[w] = ~(pIn1[w] & pIn2[w]);
+    EXPECT_TRUE(Abc_TtEqual(pOut, pRef, nWords));
+    Abc_TtXor(pOut, pIn1, pIn2, nWords, 0);
+    EXPECT_EQ(Abc_TtCountOnesVec(pOut, nWords), Abc_TtCountOnesVecXor(pIn1, pIn2, nWords));
+  }
+}
+
+ABC_NAMESPACE_IMPL_END